@@ -1,26 +1,49 @@
 #ifndef Z_SAYAN_ALGORITHM_HPP_INCLUDED
 #define Z_SAYAN_ALGORITHM_HPP_INCLUDED
 
+#include <sayan/cursor/counted.hpp>
 #include <sayan/cursor/defs.hpp>
 #include <sayan/cursor/sequence_to_cursor.hpp>
 #include <sayan/cursor/reverse.hpp>
+#include <sayan/cursor/layout.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <experimental/functional>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 namespace sayan
 {
 inline namespace v1
 {
     struct for_each_fn
     {
+    public:
         template <class InputSequence, class UnaryFunction>
         safe_cursor_type_t<InputSequence>
         operator()(InputSequence && in, UnaryFunction fun) const
         {
             auto cur = sayan::cursor_fwd<InputSequence>(in);
 
+            return this->impl(std::move(cur), fun, cursor_layout_t<decltype(cur)>{});
+        }
+
+    private:
+        template <class InputCursor, class UnaryFunction>
+        InputCursor impl(InputCursor cur, UnaryFunction & fun, generic_layout_tag) const
+        {
             for(; !!cur; ++ cur)
             {
                 fun(*cur);
@@ -28,6 +51,19 @@ inline namespace v1
 
             return cur;
         }
+
+        template <class SegmentedCursor, class UnaryFunction>
+        SegmentedCursor impl(SegmentedCursor cur, UnaryFunction & fun, segmented_layout_tag) const
+        {
+            for(auto s = ::sayan::segments(cur); !!s; ++ s)
+            {
+                auto seg = *s;
+                this->impl(std::move(seg), fun, cursor_layout_t<decltype(seg)>{});
+            }
+
+            cur.exhaust(::sayan::front);
+            return cur;
+        }
     };
 
     struct find_if_fn
@@ -58,8 +94,311 @@ inline namespace v1
         }
     };
 
+    /// @cond false
+    namespace details
+    {
+        /* Типы, значения которых можно обрабатывать блоками по 16 байт:
+        целое число элементов помещается в блок, и ни один элемент не
+        пересекает границу блока.
+        */
+        template <class T>
+        struct is_simd_block_compatible
+         : std::integral_constant<bool, (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4
+                                         || sizeof(T) == 8 || sizeof(T) == 16)
+                                        && alignof(T) == sizeof(T)>
+        {};
+
+#if defined(__SSE2__)
+        // Блок из 16 байт, заполненный копиями значения
+        template <class T>
+        __m128i broadcast_block(T const & value)
+        {
+            static_assert(is_simd_block_compatible<T>::value, "");
+
+            alignas(16) unsigned char pattern[16];
+            for(std::size_t i = 0; i != sizeof(pattern); i += sizeof(T))
+            {
+                std::memcpy(pattern + i, &value, sizeof(T));
+            }
+
+            return _mm_load_si128(reinterpret_cast<__m128i const *>(pattern));
+        }
+
+        /* Поэлементное сравнение на равенство: в результате все байты
+        совпавших элементов равны 0xFF, остальные -- нулю
+        */
+        inline __m128i simd_equal_lanes(__m128i x, __m128i y,
+                                        std::integral_constant<std::size_t, 1>, std::false_type)
+        {
+            return _mm_cmpeq_epi8(x, y);
+        }
+
+        inline __m128i simd_equal_lanes(__m128i x, __m128i y,
+                                        std::integral_constant<std::size_t, 2>, std::false_type)
+        {
+            return _mm_cmpeq_epi16(x, y);
+        }
+
+        inline __m128i simd_equal_lanes(__m128i x, __m128i y,
+                                        std::integral_constant<std::size_t, 4>, std::false_type)
+        {
+            return _mm_cmpeq_epi32(x, y);
+        }
+
+        // В SSE2 нет сравнения 64-битных целых: совпасть должны обе половины
+        inline __m128i simd_equal_lanes(__m128i x, __m128i y,
+                                        std::integral_constant<std::size_t, 8>, std::false_type)
+        {
+            auto const halves = _mm_cmpeq_epi32(x, y);
+            return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+
+        inline __m128i simd_equal_lanes(__m128i x, __m128i y,
+                                        std::integral_constant<std::size_t, 4>, std::true_type)
+        {
+            return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(x), _mm_castsi128_ps(y)));
+        }
+
+        inline __m128i simd_equal_lanes(__m128i x, __m128i y,
+                                        std::integral_constant<std::size_t, 8>, std::true_type)
+        {
+            return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(x), _mm_castsi128_pd(y)));
+        }
+
+        template <class T>
+        __m128i simd_equal_lanes(__m128i x, __m128i y)
+        {
+            return details::simd_equal_lanes(x, y, std::integral_constant<std::size_t, sizeof(T)>{},
+                                             std::is_floating_point<T>{});
+        }
+
+        // Элементы x, для которых в маске все биты равны 1, и элементы y для остальных
+        inline __m128i simd_select(__m128i mask, __m128i x, __m128i y)
+        {
+            return _mm_or_si128(_mm_and_si128(mask, x), _mm_andnot_si128(mask, y));
+        }
+#endif
+
+        // Пересечение интервалов памяти [first1, last1) и [first2, last2)
+        inline bool memory_overlaps(void const * first1, void const * last1,
+                                    void const * first2, void const * last2)
+        {
+            auto const address = [](void const * p) { return reinterpret_cast<std::uintptr_t>(p); };
+
+            return address(first1) < address(last2) && address(first2) < address(last1);
+        }
+
+        template <class T>
+        class value_restorer
+        {
+        public:
+            explicit value_restorer(T & x)
+             : ref_(x)
+             , old_value_(x)
+            {}
+
+            ~value_restorer()
+            {
+                this->ref_ = this->old_value_;
+            }
+
+            T const & old_value() const
+            {
+                return this->old_value_;
+            }
+
+        private:
+            T & ref_;
+            T const old_value_;
+        };
+
+        template <class T, class Value>
+        struct is_sentinel_compatible
+         : std::integral_constant<bool, !std::is_const<T>::value
+                                        && std::is_trivially_copyable<T>::value
+                                        && std::is_copy_assignable<T>::value
+                                        && std::is_constructible<T, Value const &>::value>
+        {};
+
+        template <class T, class Value, class BinaryPredicate>
+        T * find_contiguous(T * first, T * last, Value const & value, BinaryPredicate & bin_pred,
+                            std::false_type)
+        {
+            for(; first != last && !bin_pred(*first, value); ++ first)
+            {}
+
+            return first;
+        }
+
+        /* Поиск с барьером: искомое значение временно записывается в последний
+        элемент, поэтому цикл не проверяет достижение конца последовательности.
+        */
+        template <class T, class Value, class BinaryPredicate>
+        T * find_contiguous(T * first, T * last, Value const & value, BinaryPredicate & bin_pred,
+                            std::true_type)
+        {
+            if(first == last)
+            {
+                return last;
+            }
+
+            T const sentinel(value);
+
+            if(!bin_pred(sentinel, value))
+            {
+                return details::find_contiguous(first, last, value, bin_pred, std::false_type{});
+            }
+
+            auto const back = last - 1;
+            {
+                details::value_restorer<T> guard(*back);
+                *back = sentinel;
+
+                for(; !bin_pred(*first, value); ++ first)
+                {}
+            }
+
+            if(first != back || bin_pred(*back, value))
+            {
+                return first;
+            }
+
+            return last;
+        }
+
+        /* Значения арифметических типов, которые можно сравнивать на
+        равенство поблочно. Значение смешанного целого типа допускается, так
+        как преобразование элементов к общему типу сравнения взаимно
+        однозначно. Для чисел с плавающей точкой требуется совпадение типов.
+        */
+        template <class T, class Value>
+        struct is_simd_equality_comparable
+         : std::integral_constant<bool, std::is_arithmetic<T>::value
+                                        && !std::is_same<std::remove_cv_t<T>, bool>::value
+                                        && !std::is_volatile<T>::value
+                                        && is_simd_block_compatible<T>::value
+                                        && sizeof(T) <= 8
+                                        && ((std::is_integral<T>::value
+                                             && std::is_integral<Value>::value
+                                             && !std::is_same<Value, bool>::value)
+                                            || std::is_same<std::remove_cv_t<T>, Value>::value)>
+        {};
+
+        /* Поиск по равенству в последовательности арифметических значений:
+        байты ищутся с помощью memchr, более широкие типы -- сравнением
+        блоков по 16 байт.
+        */
+        template <class T, class Value, class BinaryPredicate>
+        struct is_simd_find_compatible
+         : std::integral_constant<bool, std::is_same<BinaryPredicate, std::equal_to<>>::value
+                                        && is_simd_equality_comparable<T, Value>::value
+#if !defined(__SSE2__)
+                                        && sizeof(T) == 1
+#endif
+                                        >
+        {};
+
+        struct simd_find_tag {};
+
+        template <class T, class Value, class BinaryPredicate>
+        using find_contiguous_tag_t
+            = std::conditional_t<is_simd_find_compatible<T, Value, BinaryPredicate>::value,
+                                 simd_find_tag, std::false_type>;
+
+        template <class T, class Value, class BinaryPredicate>
+        using find_with_sentinel_tag_t
+            = std::conditional_t<is_simd_find_compatible<T, Value, BinaryPredicate>::value,
+                                 simd_find_tag, is_sentinel_compatible<T, Value>>;
+
+        template <class T>
+        T * find_equal(T * first, T * last, std::remove_cv_t<T> const value,
+                       std::true_type)
+        {
+            if(first == last)
+            {
+                return last;
+            }
+
+            unsigned char byte;
+            std::memcpy(&byte, &value, 1);
+
+            auto const pos = std::memchr(first, byte, static_cast<std::size_t>(last - first));
+
+            return pos == nullptr ? last : first + (static_cast<char const *>(pos)
+                                                    - reinterpret_cast<char const *>(first));
+        }
+
+#if defined(__SSE2__)
+        /* Четыре блока сравниваются за итерацию, положение совпадения
+        уточняется только в блоке, где оно найдено
+        */
+        template <class T>
+        T * find_equal(T * first, T * last, std::remove_cv_t<T> const value,
+                       std::false_type)
+        {
+            using Element = std::remove_cv_t<T>;
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(T));
+
+            auto const block = details::broadcast_block(value);
+
+            auto const load = [](T * p)
+            {
+                return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+            };
+
+            for(; last - first >= 4 * lanes; first += 4 * lanes)
+            {
+                auto const e0 = details::simd_equal_lanes<Element>(load(first), block);
+                auto const e1 = details::simd_equal_lanes<Element>(load(first + lanes), block);
+                auto const e2 = details::simd_equal_lanes<Element>(load(first + 2 * lanes), block);
+                auto const e3 = details::simd_equal_lanes<Element>(load(first + 3 * lanes), block);
+
+                auto const any = _mm_or_si128(_mm_or_si128(e0, e1), _mm_or_si128(e2, e3));
+
+                if(_mm_movemask_epi8(any) != 0)
+                {
+                    break;
+                }
+            }
+
+            for(; last - first >= lanes; first += lanes)
+            {
+                auto const eq = details::simd_equal_lanes<Element>(load(first), block);
+
+                if(_mm_movemask_epi8(eq) != 0)
+                {
+                    break;
+                }
+            }
+
+            for(; first != last && !(*first == value); ++ first)
+            {}
+
+            return first;
+        }
+#endif
+
+        template <class T, class Value, class BinaryPredicate>
+        T * find_contiguous(T * first, T * last, Value const & value, BinaryPredicate & bin_pred,
+                            simd_find_tag)
+        {
+            std::remove_cv_t<T> const x(value);
+
+            // Значение, не представимое в типе элементов, не равно ни одному из них
+            if(!bin_pred(x, value))
+            {
+                return last;
+            }
+
+            return details::find_equal(first, last, x, std::integral_constant<bool, sizeof(T) == 1>{});
+        }
+    }
+    // namespace details
+    /// @endcond
+
     struct find_fn
     {
+    public:
         template <class InputSequence, class T, class BinaryPredicate = std::equal_to<>>
         safe_cursor_type_t<InputSequence>
         operator()(InputSequence && in, T const & value,
@@ -67,10 +406,103 @@ inline namespace v1
         {
             auto cur = sayan::cursor_fwd<InputSequence>(in);
 
+            return this->impl(std::move(cur), value, bin_pred,
+                              cursor_layout_t<decltype(cur)>{});
+        }
+
+    private:
+        template <class InputCursor, class T, class BinaryPredicate>
+        InputCursor impl(InputCursor cur, T const & value, BinaryPredicate & bin_pred,
+                         generic_layout_tag) const
+        {
             using Ref = decltype(*cur);
             return ::sayan::find_if_fn{}(std::move(cur),
                                          [&value, &bin_pred](Ref x){ return bin_pred(x, value); });
         }
+
+        template <class ContiguousCursor, class T, class BinaryPredicate>
+        ContiguousCursor impl(ContiguousCursor cur, T const & value, BinaryPredicate & bin_pred,
+                              contiguous_layout_tag) const
+        {
+            auto const first = ::sayan::cursor_data(cur);
+            auto const last = first + cur.size();
+
+            using Value = std::remove_pointer_t<decltype(first)>;
+            using Tag = details::find_contiguous_tag_t<Value, T, BinaryPredicate>;
+
+            cur += details::find_contiguous(first, last, value, bin_pred, Tag{}) - first;
+            return cur;
+        }
+
+        template <class SegmentedCursor, class T, class BinaryPredicate>
+        SegmentedCursor impl(SegmentedCursor cur, T const & value, BinaryPredicate & bin_pred,
+                             segmented_layout_tag) const
+        {
+            auto n = difference_type_t<SegmentedCursor>{0};
+
+            for(auto s = ::sayan::segments(cur); !!s; ++ s)
+            {
+                auto const r = (*this)(*s, value, bin_pred);
+
+                n += details::traversed_size(r);
+
+                if(!!r)
+                {
+                    break;
+                }
+            }
+
+            cur += n;
+            return cur;
+        }
+    };
+
+    /** @brief Поиск с барьером
+    @details В отличие от find, для непрерывной последовательности изменяемых
+    тривиально копируемых элементов искомое значение временно записывается в
+    последний элемент, что позволяет не проверять достижение конца
+    последовательности в цикле. После поиска (в том числе при выходе по
+    исключению) последний элемент восстанавливается. Так как
+    последовательность изменяется, её нельзя использовать одновременно в
+    других потоках, даже только для чтения, а память должна быть доступна для
+    записи. В остальных случаях, а также если для поиска применимы векторные
+    инструкции, поиск выполняется так же, как в find.
+    */
+    struct find_with_sentinel_fn
+    {
+    public:
+        template <class InputSequence, class T, class BinaryPredicate = std::equal_to<>>
+        safe_cursor_type_t<InputSequence>
+        operator()(InputSequence && in, T const & value,
+                   BinaryPredicate bin_pred = BinaryPredicate{}) const
+        {
+            auto cur = sayan::cursor_fwd<InputSequence>(in);
+
+            return this->impl(std::move(cur), value, bin_pred,
+                              cursor_layout_t<decltype(cur)>{});
+        }
+
+    private:
+        template <class InputCursor, class T, class BinaryPredicate>
+        InputCursor impl(InputCursor cur, T const & value, BinaryPredicate & bin_pred,
+                         generic_layout_tag) const
+        {
+            return ::sayan::find_fn{}(std::move(cur), value, bin_pred);
+        }
+
+        template <class ContiguousCursor, class T, class BinaryPredicate>
+        ContiguousCursor impl(ContiguousCursor cur, T const & value, BinaryPredicate & bin_pred,
+                              contiguous_layout_tag) const
+        {
+            auto const first = ::sayan::cursor_data(cur);
+            auto const last = first + cur.size();
+
+            using Value = std::remove_pointer_t<decltype(first)>;
+            using Tag = details::find_with_sentinel_tag_t<Value, T, BinaryPredicate>;
+
+            cur += details::find_contiguous(first, last, value, bin_pred, Tag{}) - first;
+            return cur;
+        }
     };
 
     struct find_first_of_fn
@@ -96,14 +528,517 @@ inline namespace v1
         }
     };
 
+    struct all_of_fn
+    {
+        template <class InputSequence, class UnaryPredicate>
+        bool operator()(InputSequence && in, UnaryPredicate pred) const
+        {
+            return !::sayan::find_if_not_fn{}(std::forward<InputSequence>(in),
+                                              std::move(pred));
+        }
+    };
+
+    struct any_of_fn
+    {
+        template <class InputSequence, class UnaryPredicate>
+        bool operator()(InputSequence && in, UnaryPredicate pred) const
+        {
+            return !!::sayan::find_if_fn{}(std::forward<InputSequence>(in),
+                                           std::move(pred));
+        }
+    };
+
+    struct none_of_fn
+    {
+        template <class InputSequence, class UnaryPredicate>
+        bool operator()(InputSequence && in, UnaryPredicate pred) const
+        {
+            return !::sayan::any_of_fn{}(std::forward<InputSequence>(in),
+                                         std::move(pred));
+        }
+    };
+
+    struct count_if_fn
+    {
+        template <class InputSequence, class UnaryPredicate>
+        difference_type_t<safe_cursor_type_t<InputSequence>>
+        operator()(InputSequence && in, UnaryPredicate pred) const
+        {
+            auto result = difference_type_t<safe_cursor_type_t<InputSequence>>{0};
+
+            auto cur = sayan::cursor_fwd<InputSequence>(in);
+
+            for(; !!cur; ++ cur)
+            {
+                if(pred(*cur))
+                {
+                    ++ result;
+                }
+            }
+
+            return result;
+        }
+    };
+
+    /// @cond false
+    namespace details
+    {
+        /* Подсчёт в последовательности арифметических значений сравнением
+        блоков по 16 байт. Поддерживаются предикаты std::equal_to<>,
+        std::not_equal_to<> (по правилам поиска по равенству), а также
+        std::less<> и std::greater<> при совпадении типов элементов и значения
+        (кроме 64-битных целых, для которых в SSE2 нет сравнения).
+        */
+        template <class T, class Value, class BinaryPredicate>
+        struct is_simd_count_compatible
+         : std::false_type
+        {};
+
+#if defined(__SSE2__)
+        template <class T, class Value>
+        struct is_simd_count_compatible<T, Value, std::equal_to<>>
+         : is_simd_equality_comparable<T, Value>
+        {};
+
+        template <class T, class Value>
+        struct is_simd_count_compatible<T, Value, std::not_equal_to<>>
+         : is_simd_equality_comparable<T, Value>
+        {};
+
+        template <class T, class Value>
+        struct is_simd_ordering_comparable
+         : std::integral_constant<bool, is_simd_equality_comparable<T, Value>::value
+                                        && std::is_same<std::remove_cv_t<T>, Value>::value
+                                        && (std::is_floating_point<T>::value || sizeof(T) <= 4)>
+        {};
+
+        template <class T, class Value>
+        struct is_simd_count_compatible<T, Value, std::less<>>
+         : is_simd_ordering_comparable<T, Value>
+        {};
+
+        template <class T, class Value>
+        struct is_simd_count_compatible<T, Value, std::greater<>>
+         : is_simd_ordering_comparable<T, Value>
+        {};
+
+        struct simd_signed_tag {};
+        struct simd_unsigned_tag {};
+        struct simd_floating_tag {};
+
+        template <class T>
+        using simd_number_kind_t
+            = std::conditional_t<std::is_floating_point<T>::value, simd_floating_tag,
+                                 std::conditional_t<std::is_signed<T>::value,
+                                                    simd_signed_tag, simd_unsigned_tag>>;
+
+        // Поэлементное сравнение x < y с результатом в том же виде, что и simd_equal_lanes
+        inline __m128i simd_less_lanes(__m128i x, __m128i y,
+                                       std::integral_constant<std::size_t, 1>, simd_signed_tag)
+        {
+            return _mm_cmplt_epi8(x, y);
+        }
+
+        inline __m128i simd_less_lanes(__m128i x, __m128i y,
+                                       std::integral_constant<std::size_t, 2>, simd_signed_tag)
+        {
+            return _mm_cmplt_epi16(x, y);
+        }
+
+        inline __m128i simd_less_lanes(__m128i x, __m128i y,
+                                       std::integral_constant<std::size_t, 4>, simd_signed_tag)
+        {
+            return _mm_cmplt_epi32(x, y);
+        }
+
+        // Беззнаковые числа сравниваются как знаковые после инверсии старшего бита
+        inline __m128i simd_less_lanes(__m128i x, __m128i y,
+                                       std::integral_constant<std::size_t, 1> size, simd_unsigned_tag)
+        {
+            auto const bias = _mm_set1_epi8(-128);
+            return details::simd_less_lanes(_mm_xor_si128(x, bias), _mm_xor_si128(y, bias),
+                                            size, simd_signed_tag{});
+        }
+
+        inline __m128i simd_less_lanes(__m128i x, __m128i y,
+                                       std::integral_constant<std::size_t, 2> size, simd_unsigned_tag)
+        {
+            auto const bias = _mm_set1_epi16(-32768);
+            return details::simd_less_lanes(_mm_xor_si128(x, bias), _mm_xor_si128(y, bias),
+                                            size, simd_signed_tag{});
+        }
+
+        inline __m128i simd_less_lanes(__m128i x, __m128i y,
+                                       std::integral_constant<std::size_t, 4> size, simd_unsigned_tag)
+        {
+            auto const bias = _mm_set1_epi32(-2147483647 - 1);
+            return details::simd_less_lanes(_mm_xor_si128(x, bias), _mm_xor_si128(y, bias),
+                                            size, simd_signed_tag{});
+        }
+
+        inline __m128i simd_less_lanes(__m128i x, __m128i y,
+                                       std::integral_constant<std::size_t, 4>, simd_floating_tag)
+        {
+            return _mm_castps_si128(_mm_cmplt_ps(_mm_castsi128_ps(x), _mm_castsi128_ps(y)));
+        }
+
+        inline __m128i simd_less_lanes(__m128i x, __m128i y,
+                                       std::integral_constant<std::size_t, 8>, simd_floating_tag)
+        {
+            return _mm_castpd_si128(_mm_cmplt_pd(_mm_castsi128_pd(x), _mm_castsi128_pd(y)));
+        }
+
+        template <class T>
+        __m128i simd_less_lanes(__m128i x, __m128i y)
+        {
+            return details::simd_less_lanes(x, y, std::integral_constant<std::size_t, sizeof(T)>{},
+                                            simd_number_kind_t<T>{});
+        }
+
+        // Счётчики в элементах блока: беззнаковые целые того же размера, что и элементы
+        template <std::size_t Size>
+        struct simd_counter;
+
+        template <>
+        struct simd_counter<1>
+        {
+            using type = std::uint8_t;
+
+            static __m128i subtract(__m128i x, __m128i y)
+            {
+                return _mm_sub_epi8(x, y);
+            }
+        };
+
+        template <>
+        struct simd_counter<2>
+        {
+            using type = std::uint16_t;
+
+            static __m128i subtract(__m128i x, __m128i y)
+            {
+                return _mm_sub_epi16(x, y);
+            }
+        };
+
+        template <>
+        struct simd_counter<4>
+        {
+            using type = std::uint32_t;
+
+            static __m128i subtract(__m128i x, __m128i y)
+            {
+                return _mm_sub_epi32(x, y);
+            }
+        };
+
+        template <>
+        struct simd_counter<8>
+        {
+            using type = std::uint64_t;
+
+            static __m128i subtract(__m128i x, __m128i y)
+            {
+                return _mm_sub_epi64(x, y);
+            }
+        };
+
+        /* Маска совпадения (все биты элемента равны 1, то есть -1) вычитается
+        из счётчиков. Чтобы счётчики не переполнились, их сумма переносится в
+        результат после не более чем numeric_limits<Counter>::max() блоков.
+        */
+        template <class T, class Compare, class BinaryPredicate>
+        std::ptrdiff_t count_blocks(T * first, T * last, std::remove_cv_t<T> const value,
+                                    Compare compare, BinaryPredicate & bin_pred)
+        {
+            using Counter = simd_counter<sizeof(T)>;
+            using Lane = typename Counter::type;
+
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(T));
+            constexpr auto max_blocks = std::numeric_limits<Lane>::max();
+
+            auto const block = details::broadcast_block(value);
+
+            auto result = std::ptrdiff_t{0};
+
+            while(last - first >= lanes)
+            {
+                auto const n_blocks
+                    = std::min<std::uintmax_t>(static_cast<std::uintmax_t>((last - first) / lanes),
+                                               max_blocks);
+
+                auto counters = _mm_setzero_si128();
+
+                for(std::uintmax_t i = 0; i != n_blocks; ++ i, first += lanes)
+                {
+                    auto const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+                    counters = Counter::subtract(counters, compare(x, block));
+                }
+
+                alignas(16) Lane sums[lanes];
+                _mm_store_si128(reinterpret_cast<__m128i *>(sums), counters);
+
+                for(auto const & sum : sums)
+                {
+                    result += static_cast<std::ptrdiff_t>(sum);
+                }
+            }
+
+            for(; first != last; ++ first)
+            {
+                if(bin_pred(*first, value))
+                {
+                    ++ result;
+                }
+            }
+
+            return result;
+        }
+
+        template <class T, class Value>
+        std::ptrdiff_t count_simd(T * first, T * last, Value const & value,
+                                  std::equal_to<> & bin_pred)
+        {
+            using Element = std::remove_cv_t<T>;
+            auto const equal = [](__m128i x, __m128i y)
+            {
+                return details::simd_equal_lanes<Element>(x, y);
+            };
+
+            Element const x(value);
+
+            // Значение, не представимое в типе элементов, не равно ни одному из них
+            if(!bin_pred(x, value))
+            {
+                return 0;
+            }
+
+            return details::count_blocks(first, last, x, equal, bin_pred);
+        }
+
+        template <class T, class Value>
+        std::ptrdiff_t count_simd(T * first, T * last, Value const & value,
+                                  std::not_equal_to<> &)
+        {
+            auto equal = std::equal_to<>{};
+            return (last - first) - details::count_simd(first, last, value, equal);
+        }
+
+        template <class T>
+        std::ptrdiff_t count_simd(T * first, T * last, std::remove_cv_t<T> const & value,
+                                  std::less<> & bin_pred)
+        {
+            using Element = std::remove_cv_t<T>;
+            auto const less = [](__m128i x, __m128i y)
+            {
+                return details::simd_less_lanes<Element>(x, y);
+            };
+
+            return details::count_blocks(first, last, value, less, bin_pred);
+        }
+
+        template <class T>
+        std::ptrdiff_t count_simd(T * first, T * last, std::remove_cv_t<T> const & value,
+                                  std::greater<> & bin_pred)
+        {
+            using Element = std::remove_cv_t<T>;
+            auto const greater = [](__m128i x, __m128i y)
+            {
+                return details::simd_less_lanes<Element>(y, x);
+            };
+
+            return details::count_blocks(first, last, value, greater, bin_pred);
+        }
+
+        template <class T, class Value, class BinaryPredicate>
+        std::ptrdiff_t count_contiguous(T * first, T * last, Value const & value,
+                                        BinaryPredicate & bin_pred, std::true_type)
+        {
+            return details::count_simd(first, last, value, bin_pred);
+        }
+#endif
+
+        template <class T, class Value, class BinaryPredicate>
+        std::ptrdiff_t count_contiguous(T * first, T * last, Value const & value,
+                                        BinaryPredicate & bin_pred, std::false_type)
+        {
+            auto result = std::ptrdiff_t{0};
+
+            for(; first != last; ++ first)
+            {
+                if(bin_pred(*first, value))
+                {
+                    ++ result;
+                }
+            }
+
+            return result;
+        }
+    }
+    // namespace details
+    /// @endcond
+
+    struct count_fn
+    {
+    public:
+        template <class InputSequence, class T, class BinaryPredicate = std::equal_to<>>
+        difference_type_t<safe_cursor_type_t<InputSequence>>
+        operator()(InputSequence && in, T const & value,
+                   BinaryPredicate bin_pred = BinaryPredicate{}) const
+        {
+            auto cur = ::sayan::cursor_fwd<InputSequence>(in);
+
+            return this->impl(std::move(cur), value, bin_pred,
+                              cursor_layout_t<decltype(cur)>{});
+        }
+
+    private:
+        template <class InputCursor, class T, class BinaryPredicate>
+        difference_type_t<InputCursor>
+        impl(InputCursor cur, T const & value, BinaryPredicate & bin_pred,
+             generic_layout_tag) const
+        {
+            using Ref = decltype(*cur);
+            return ::sayan::count_if_fn{}(std::move(cur),
+                                          [&value, &bin_pred](Ref x){return bin_pred(x, value);});
+        }
+
+        template <class ContiguousCursor, class T, class BinaryPredicate>
+        difference_type_t<ContiguousCursor>
+        impl(ContiguousCursor cur, T const & value, BinaryPredicate & bin_pred,
+             contiguous_layout_tag) const
+        {
+            auto const first = ::sayan::cursor_data(cur);
+            auto const last = first + cur.size();
+
+            using Value = std::remove_pointer_t<decltype(first)>;
+            using Vectorized = details::is_simd_count_compatible<Value, T, BinaryPredicate>;
+
+            auto const n = details::count_contiguous(first, last, value, bin_pred, Vectorized{});
+            return static_cast<difference_type_t<ContiguousCursor>>(n);
+        }
+
+        template <class SegmentedCursor, class T, class BinaryPredicate>
+        difference_type_t<SegmentedCursor>
+        impl(SegmentedCursor cur, T const & value, BinaryPredicate & bin_pred,
+             segmented_layout_tag) const
+        {
+            auto result = difference_type_t<SegmentedCursor>{0};
+
+            for(auto s = ::sayan::segments(cur); !!s; ++ s)
+            {
+                result += (*this)(*s, value, bin_pred);
+            }
+
+            return result;
+        }
+    };
+
+    /// @cond false
+    namespace details
+    {
+        template <class T, class BinaryPredicate>
+        struct is_simd_adjacent_find_compatible
+         : is_simd_count_compatible<T, std::remove_cv_t<T>, BinaryPredicate>
+        {};
+
+#if defined(__SSE2__)
+        // Поэлементное вычисление предиката для блоков
+        template <class T>
+        __m128i simd_predicate_lanes(__m128i x, __m128i y, std::equal_to<>)
+        {
+            return details::simd_equal_lanes<T>(x, y);
+        }
+
+        template <class T>
+        __m128i simd_predicate_lanes(__m128i x, __m128i y, std::not_equal_to<>)
+        {
+            return _mm_xor_si128(details::simd_equal_lanes<T>(x, y), _mm_set1_epi32(-1));
+        }
+
+        template <class T>
+        __m128i simd_predicate_lanes(__m128i x, __m128i y, std::less<>)
+        {
+            return details::simd_less_lanes<T>(x, y);
+        }
+
+        template <class T>
+        __m128i simd_predicate_lanes(__m128i x, __m128i y, std::greater<>)
+        {
+            return details::simd_less_lanes<T>(y, x);
+        }
+
+        /* Блок сравнивается с блоком, сдвинутым на один элемент; точное
+        положение пары уточняется поэлементно только в блоке, где предикат
+        выполнен хотя бы для одной пары
+        */
+        template <class T, class BinaryPredicate>
+        T * adjacent_find_blocks(T * first, T * last, BinaryPredicate bin_pred)
+        {
+            using Element = std::remove_cv_t<T>;
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(T));
+
+            auto const load = [](T * p)
+            {
+                return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+            };
+
+            for(; last - first > 2 * lanes; first += 2 * lanes)
+            {
+                auto const m0 = details::simd_predicate_lanes<Element>(load(first), load(first + 1),
+                                                                       bin_pred);
+                auto const m1 = details::simd_predicate_lanes<Element>(load(first + lanes),
+                                                                       load(first + lanes + 1),
+                                                                       bin_pred);
+
+                if(_mm_movemask_epi8(_mm_or_si128(m0, m1)) != 0)
+                {
+                    break;
+                }
+            }
+
+            if(first == last)
+            {
+                return last;
+            }
+
+            for(; first + 1 != last; ++ first)
+            {
+                if(bin_pred(first[0], first[1]))
+                {
+                    return first;
+                }
+            }
+
+            return last;
+        }
+#endif
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Поиск первой пары соседних элементов, удовлетворяющих предикату
+    @details Для непрерывных последовательностей арифметических значений и
+    предикатов std::equal_to<>, std::not_equal_to<>, std::less<> и
+    std::greater<> соседние элементы сравниваются блоками с помощью SSE2
+    (упорядочивающие предикаты -- кроме 64-битных целых).
+    */
     struct adjacent_find_fn
     {
+    public:
         template <class ForwardSequence, class BinaryPredicate = std::equal_to<>>
         safe_cursor_type_t<ForwardSequence>
         operator()(ForwardSequence && seq, BinaryPredicate bin_pred = BinaryPredicate{}) const
         {
             auto c1 = ::sayan::cursor_fwd<ForwardSequence>(seq);
 
+            return this->impl(std::move(c1), bin_pred, cursor_layout_t<decltype(c1)>{});
+        }
+
+    private:
+        template <class ForwardCursor, class BinaryPredicate>
+        ForwardCursor impl(ForwardCursor c1, BinaryPredicate & bin_pred, generic_layout_tag) const
+        {
             if(!c1)
             {
                 return c1;
@@ -124,77 +1059,139 @@ inline namespace v1
 
             return c2;
         }
-    };
 
-    struct all_of_fn
-    {
-        template <class InputSequence, class UnaryPredicate>
-        bool operator()(InputSequence && in, UnaryPredicate pred) const
+        template <class ContiguousCursor, class BinaryPredicate>
+        ContiguousCursor impl(ContiguousCursor cur, BinaryPredicate & bin_pred,
+                              contiguous_layout_tag) const
         {
-            return !::sayan::find_if_not_fn{}(std::forward<InputSequence>(in),
-                                              std::move(pred));
+            using Element = std::remove_pointer_t<::sayan::contiguous_pointer_t<ContiguousCursor>>;
+            using Vectorized = details::is_simd_adjacent_find_compatible<Element, BinaryPredicate>;
+
+            return this->impl_contiguous(std::move(cur), bin_pred, Vectorized{});
         }
-    };
 
-    struct any_of_fn
-    {
-        template <class InputSequence, class UnaryPredicate>
-        bool operator()(InputSequence && in, UnaryPredicate pred) const
+        template <class ContiguousCursor, class BinaryPredicate>
+        ContiguousCursor impl_contiguous(ContiguousCursor cur, BinaryPredicate & bin_pred,
+                                         std::false_type) const
         {
-            return !!::sayan::find_if_fn{}(std::forward<InputSequence>(in),
-                                           std::move(pred));
+            return this->impl(std::move(cur), bin_pred, generic_layout_tag{});
         }
-    };
 
-    struct none_of_fn
-    {
-        template <class InputSequence, class UnaryPredicate>
-        bool operator()(InputSequence && in, UnaryPredicate pred) const
+#if defined(__SSE2__)
+        template <class ContiguousCursor, class BinaryPredicate>
+        ContiguousCursor impl_contiguous(ContiguousCursor cur, BinaryPredicate & bin_pred,
+                                         std::true_type) const
         {
-            return !::sayan::any_of_fn{}(std::forward<InputSequence>(in),
-                                         std::move(pred));
+            auto const first = ::sayan::cursor_data(cur);
+            auto const last = first + cur.size();
+
+            cur += details::adjacent_find_blocks(first, last, bin_pred) - first;
+            return cur;
         }
+#endif
     };
 
-    struct count_if_fn
+    /// @cond false
+    namespace details
     {
-        template <class InputSequence, class UnaryPredicate>
-        difference_type_t<safe_cursor_type_t<InputSequence>>
-        operator()(InputSequence && in, UnaryPredicate pred) const
+        /* Типы, равенство значений которых равносильно совпадению
+        представлений в памяти
+        */
+        template <class T1, class T2>
+        struct is_bitwise_equality_comparable
+         : std::integral_constant<bool, std::is_same<std::remove_cv_t<T1>, std::remove_cv_t<T2>>::value
+                                        && !std::is_volatile<T1>::value
+                                        && !std::is_volatile<T2>::value
+                                        && ((std::is_integral<T1>::value
+                                             && !std::is_same<std::remove_cv_t<T1>, bool>::value)
+                                            || std::is_enum<T1>::value
+                                            || std::is_pointer<T1>::value)>
+        {};
+
+        template <class Cursor1, class Cursor2, class BinaryPredicate, class DefaultPredicate,
+                  bool = ::sayan::is_contiguous_cursor<Cursor1>::value
+                         && ::sayan::is_contiguous_cursor<Cursor2>::value>
+        struct is_bitwise_comparable_cursors
+         : std::false_type
+        {};
+
+        template <class Cursor1, class Cursor2, class BinaryPredicate, class DefaultPredicate>
+        struct is_bitwise_comparable_cursors<Cursor1, Cursor2, BinaryPredicate, DefaultPredicate, true>
+         : std::integral_constant<bool, std::is_same<BinaryPredicate, DefaultPredicate>::value
+                                        && is_bitwise_equality_comparable<std::remove_pointer_t<::sayan::contiguous_pointer_t<Cursor1>>,
+                                                                          std::remove_pointer_t<::sayan::contiguous_pointer_t<Cursor2>>>::value>
+        {};
+
+        // Номер первого несовпадающего байта или n, если все байты совпадают
+        inline std::size_t mismatch_bytes(unsigned char const * x, unsigned char const * y,
+                                          std::size_t n)
         {
-            auto result = difference_type_t<safe_cursor_type_t<InputSequence>>{0};
+            std::size_t i = 0;
 
-            auto cur = sayan::cursor_fwd<InputSequence>(in);
+#if defined(__SSE2__)
+            auto const load = [](unsigned char const * p)
+            {
+                return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+            };
 
-            for(; !!cur; ++ cur)
+            for(; i + 64 <= n; i += 64)
             {
-                if(pred(*cur))
+                auto const e0 = _mm_cmpeq_epi8(load(x + i), load(y + i));
+                auto const e1 = _mm_cmpeq_epi8(load(x + i + 16), load(y + i + 16));
+                auto const e2 = _mm_cmpeq_epi8(load(x + i + 32), load(y + i + 32));
+                auto const e3 = _mm_cmpeq_epi8(load(x + i + 48), load(y + i + 48));
+
+                auto const all = _mm_and_si128(_mm_and_si128(e0, e1), _mm_and_si128(e2, e3));
+
+                if(_mm_movemask_epi8(all) != 0xFFFF)
                 {
-                    ++ result;
+                    break;
                 }
             }
 
-            return result;
+            for(; i + 16 <= n; i += 16)
+            {
+                if(_mm_movemask_epi8(_mm_cmpeq_epi8(load(x + i), load(y + i))) != 0xFFFF)
+                {
+                    break;
+                }
+            }
+#else
+            for(; i + 64 <= n && std::memcmp(x + i, y + i, 64) == 0; i += 64)
+            {}
+#endif
+
+            for(; i != n && x[i] == y[i]; ++ i)
+            {}
+
+            return i;
         }
-    };
 
-    struct count_fn
-    {
-        template <class InputSequence, class T, class BinaryPredicate = std::equal_to<>>
-        difference_type_t<safe_cursor_type_t<InputSequence>>
-        operator()(InputSequence && in, T const & value,
-                   BinaryPredicate bin_pred = BinaryPredicate{}) const
+        // Номер первого несовпадающего элемента: он содержит первый несовпадающий байт
+        template <class T1, class T2>
+        std::size_t mismatch_bitwise(T1 * x, T2 * y, std::size_t n)
         {
-            auto cur = ::sayan::cursor_fwd<InputSequence>(in);
+            auto const bytes = details::mismatch_bytes(reinterpret_cast<unsigned char const *>(x),
+                                                       reinterpret_cast<unsigned char const *>(y),
+                                                       n * sizeof(T1));
+            return bytes / sizeof(T1);
+        }
 
-            using Ref = decltype(*cur);
-            return ::sayan::count_if_fn{}(std::move(cur),
-                                          [&value, &bin_pred](Ref x){return bin_pred(x, value);});
+        template <class Cursor1, class Cursor2>
+        std::size_t common_size(Cursor1 const & cur1, Cursor2 const & cur2)
+        {
+            auto const n1 = static_cast<std::size_t>(cur1.size());
+            auto const n2 = static_cast<std::size_t>(cur2.size());
+
+            return std::min(n1, n2);
         }
-    };
+    }
+    // namespace details
+    /// @endcond
 
     struct mismatch_fn
     {
+    public:
         template <class InputSequence1, class InputSequence2,
                   class BinaryPredicate = std::equal_to<>>
         std::pair<safe_cursor_type_t<InputSequence1>, safe_cursor_type_t<InputSequence2>>
@@ -204,26 +1201,108 @@ inline namespace v1
             auto cur1 = sayan::cursor_fwd<InputSequence1>(in1);
             auto cur2 = sayan::cursor_fwd<InputSequence2>(in2);
 
+            using Bitwise = details::is_bitwise_comparable_cursors<decltype(cur1), decltype(cur2),
+                                                                   BinaryPredicate, std::equal_to<>>;
+
+            return this->impl(std::move(cur1), std::move(cur2), bin_pred, Bitwise{});
+        }
+
+    private:
+        template <class InputCursor1, class InputCursor2, class BinaryPredicate>
+        std::pair<InputCursor1, InputCursor2>
+        impl(InputCursor1 cur1, InputCursor2 cur2, BinaryPredicate & bin_pred,
+             std::false_type) const
+        {
             for(; !!cur1 && !!cur2 && bin_pred(*cur1, *cur2); ++cur1, ++cur2)
             {}
 
             return {std::move(cur1), std::move(cur2)};
         }
+
+        template <class ContiguousCursor1, class ContiguousCursor2, class BinaryPredicate>
+        std::pair<ContiguousCursor1, ContiguousCursor2>
+        impl(ContiguousCursor1 cur1, ContiguousCursor2 cur2, BinaryPredicate &,
+             std::true_type) const
+        {
+            auto const n = details::common_size(cur1, cur2);
+            auto const k = details::mismatch_bitwise(::sayan::cursor_data(cur1),
+                                                     ::sayan::cursor_data(cur2), n);
+
+            cur1 += static_cast<difference_type_t<ContiguousCursor1>>(k);
+            cur2 += static_cast<difference_type_t<ContiguousCursor2>>(k);
+
+            return {std::move(cur1), std::move(cur2)};
+        }
     };
 
+    /// @cond false
+    namespace details
+    {
+        // Последовательности разной длины не равны, что проверяется до сравнения элементов
+        template <class Cursor1, class Cursor2>
+        bool has_different_sizes(Cursor1 const & cur1, Cursor2 const & cur2, std::true_type)
+        {
+            return cur1.size() != cur2.size();
+        }
+
+        template <class Cursor1, class Cursor2>
+        bool has_different_sizes(Cursor1 const &, Cursor2 const &, std::false_type)
+        {
+            return false;
+        }
+    }
+    // namespace details
+    /// @endcond
+
     struct equal_fn
     {
+    public:
         template <class InputSequence1, class InputSequence2,
                   class BinaryPredicate = std::equal_to<>>
         bool operator()(InputSequence1 && in1, InputSequence2 && in2,
                         BinaryPredicate bin_pred = BinaryPredicate{}) const
         {
-            auto r = ::sayan::mismatch_fn{}(std::forward<InputSequence1>(in1),
-                                            std::forward<InputSequence2>(in2),
-                                            std::move(bin_pred));
+            auto cur1 = sayan::cursor_fwd<InputSequence1>(in1);
+            auto cur2 = sayan::cursor_fwd<InputSequence2>(in2);
+
+            using Cursor1 = decltype(cur1);
+            using Cursor2 = decltype(cur2);
+            using Sized = std::integral_constant<bool, ::sayan::is_sized_cursor<Cursor1>::value
+                                                       && ::sayan::is_sized_cursor<Cursor2>::value>;
+
+            if(details::has_different_sizes(cur1, cur2, Sized{}))
+            {
+                return false;
+            }
+
+            using Bitwise = details::is_bitwise_comparable_cursors<Cursor1, Cursor2,
+                                                                   BinaryPredicate, std::equal_to<>>;
+
+            return this->impl(std::move(cur1), std::move(cur2), std::move(bin_pred), Bitwise{});
+        }
+
+    private:
+        template <class InputCursor1, class InputCursor2, class BinaryPredicate>
+        bool impl(InputCursor1 cur1, InputCursor2 cur2, BinaryPredicate bin_pred,
+                  std::false_type) const
+        {
+            auto r = ::sayan::mismatch_fn{}(std::move(cur1), std::move(cur2), std::move(bin_pred));
 
             return !r.first && !r.second;
         }
+
+        // Размеры уже совпадают
+        template <class ContiguousCursor1, class ContiguousCursor2, class BinaryPredicate>
+        bool impl(ContiguousCursor1 cur1, ContiguousCursor2 cur2, BinaryPredicate,
+                  std::true_type) const
+        {
+            auto const n = static_cast<std::size_t>(cur1.size());
+
+            using T = std::remove_pointer_t<decltype(::sayan::cursor_data(cur1))>;
+
+            return n == 0 || std::memcmp(::sayan::cursor_data(cur1), ::sayan::cursor_data(cur2),
+                                         n * sizeof(T)) == 0;
+        }
     };
 
     struct search_fn
@@ -382,8 +1461,63 @@ inline namespace v1
         }
     };
 
+    /// @cond false
+    namespace details
+    {
+        /* Беззнаковые байты упорядочены так же, как их представления,
+        поэтому сравниваются с помощью memcmp
+        */
+        template <class T>
+        struct is_memcmp_ordered
+         : std::integral_constant<bool, sizeof(T) == 1
+                                        && std::is_integral<T>::value
+                                        && std::is_unsigned<T>::value
+                                        && !std::is_same<std::remove_cv_t<T>, bool>::value>
+        {};
+
+        template <class T1, class T2, class Compare>
+        bool lexicographical_compare_bitwise(T1 * x, std::size_t n1, T2 * y, std::size_t n2,
+                                             Compare &, std::true_type)
+        {
+            auto const n = std::min(n1, n2);
+
+            if(n != 0)
+            {
+                auto const r = std::memcmp(x, y, n);
+
+                if(r != 0)
+                {
+                    return r < 0;
+                }
+            }
+
+            return n1 < n2;
+        }
+
+        /* Для остальных типов сравнивается только первая пара несовпадающих
+        элементов
+        */
+        template <class T1, class T2, class Compare>
+        bool lexicographical_compare_bitwise(T1 * x, std::size_t n1, T2 * y, std::size_t n2,
+                                             Compare & cmp, std::false_type)
+        {
+            auto const n = std::min(n1, n2);
+            auto const k = details::mismatch_bitwise(x, y, n);
+
+            if(k != n)
+            {
+                return cmp(x[k], y[k]);
+            }
+
+            return n1 < n2;
+        }
+    }
+    // namespace details
+    /// @endcond
+
     struct lexicographical_compare_fn
     {
+    public:
         template <class InputSequence1, class InputSequence2,
                   class Compare = std::less<>>
         bool operator()(InputSequence1 && in1, InputSequence2 && in2,
@@ -392,6 +1526,16 @@ inline namespace v1
             auto cur1 = sayan::cursor_fwd<InputSequence1>(in1);
             auto cur2 = sayan::cursor_fwd<InputSequence2>(in2);
 
+            using Bitwise = details::is_bitwise_comparable_cursors<decltype(cur1), decltype(cur2),
+                                                                   Compare, std::less<>>;
+
+            return this->impl(std::move(cur1), std::move(cur2), cmp, Bitwise{});
+        }
+
+    private:
+        template <class InputCursor1, class InputCursor2, class Compare>
+        bool impl(InputCursor1 cur1, InputCursor2 cur2, Compare & cmp, std::false_type) const
+        {
             for(; !!cur1 && !!cur2; ++ cur1, ++ cur2)
             {
                 if(cmp(*cur1, *cur2))
@@ -406,10 +1550,95 @@ inline namespace v1
 
             return !!cur2;
         }
+
+        template <class ContiguousCursor1, class ContiguousCursor2, class Compare>
+        bool impl(ContiguousCursor1 cur1, ContiguousCursor2 cur2, Compare & cmp,
+                  std::true_type) const
+        {
+            auto const x = ::sayan::cursor_data(cur1);
+            auto const y = ::sayan::cursor_data(cur2);
+
+            using T = std::remove_pointer_t<decltype(x)>;
+
+            return details::lexicographical_compare_bitwise(x, static_cast<std::size_t>(cur1.size()),
+                                                            y, static_cast<std::size_t>(cur2.size()),
+                                                            cmp, details::is_memcmp_ordered<T>{});
+        }
     };
 
+    /// @cond false
+    namespace details
+    {
+        template <class InputPointer, class OutputPointer,
+                  class T = std::remove_pointer_t<OutputPointer>>
+        struct is_memmove_compatible
+         : std::integral_constant<bool, std::is_same<std::remove_cv_t<std::remove_pointer_t<InputPointer>>, T>::value
+                                        && std::is_trivially_copyable<T>::value
+                                        && std::is_copy_assignable<T>::value>
+        {};
+
+        template <class InputCursor, class OutputCursor,
+                  bool = ::sayan::is_contiguous_cursor<InputCursor>::value
+                         && ::sayan::is_contiguous_cursor<OutputCursor>::value>
+        struct is_memmove_compatible_cursors
+         : std::false_type
+        {};
+
+        template <class InputCursor, class OutputCursor>
+        struct is_memmove_compatible_cursors<InputCursor, OutputCursor, true>
+         : is_memmove_compatible<::sayan::contiguous_pointer_t<InputCursor>,
+                                 ::sayan::contiguous_pointer_t<OutputCursor>>
+        {};
+
+        /* Копирование начала входной последовательности в начало выходной
+        одним вызовом memmove, поэтому допускается перекрытие.
+        */
+        template <class InputCursor, class OutputCursor>
+        std::pair<InputCursor, OutputCursor>
+        memmove_forward(InputCursor in_cur, OutputCursor out_cur)
+        {
+            auto const n = std::min<std::ptrdiff_t>(in_cur.size(), out_cur.size());
+
+            if(n > 0)
+            {
+                auto const out_first = ::sayan::cursor_data(out_cur);
+                std::memmove(out_first, ::sayan::cursor_data(in_cur), n * sizeof(*out_first));
+
+                in_cur += n;
+                out_cur += n;
+            }
+
+            return {std::move(in_cur), std::move(out_cur)};
+        }
+
+        /* Копирование конца входной последовательности в конец выходной
+        одним вызовом memmove
+        */
+        template <class InputCursor, class OutputCursor>
+        std::pair<InputCursor, OutputCursor>
+        memmove_backward(InputCursor in_cur, OutputCursor out_cur)
+        {
+            auto const n = std::min<std::ptrdiff_t>(in_cur.size(), out_cur.size());
+
+            if(n > 0)
+            {
+                auto const in_first = ::sayan::cursor_data(in_cur) + (in_cur.size() - n);
+                auto const out_first = ::sayan::cursor_data(out_cur) + (out_cur.size() - n);
+                std::memmove(out_first, in_first, n * sizeof(*out_first));
+
+                in_cur.drop(::sayan::back, n);
+                out_cur.drop(::sayan::back, n);
+            }
+
+            return {std::move(in_cur), std::move(out_cur)};
+        }
+    }
+    // namespace details
+    /// @endcond
+
     struct copy_fn
     {
+    public:
         template <class InputSequence, class OutputSequence>
         std::pair<safe_cursor_type_t<InputSequence>,
                   safe_cursor_type_t<OutputSequence>>
@@ -418,6 +1647,23 @@ inline namespace v1
             auto in_cur = sayan::cursor_fwd<InputSequence>(in);
             auto out_cur = sayan::cursor_fwd<OutputSequence>(out);
 
+            return this->impl(std::move(in_cur), std::move(out_cur));
+        }
+
+    private:
+        template <class InputCursor, class OutputCursor>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur) const
+        {
+            return this->impl(std::move(in_cur), std::move(out_cur),
+                              cursor_layout_t<InputCursor>{},
+                              cursor_layout_t<OutputCursor>{});
+        }
+
+        template <class InputCursor, class OutputCursor>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, generic_layout_tag, generic_layout_tag) const
+        {
             for(; !!in_cur && !!out_cur; ++ in_cur)
             {
                 out_cur << *in_cur;
@@ -425,10 +1671,64 @@ inline namespace v1
 
             return {std::move(in_cur), std::move(out_cur)};
         }
+
+        template <class InputCursor, class OutputCursor>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, contiguous_layout_tag, contiguous_layout_tag) const
+        {
+            return this->impl_contiguous(std::move(in_cur), std::move(out_cur),
+                                         details::is_memmove_compatible_cursors<InputCursor, OutputCursor>{});
+        }
+
+        template <class InputCursor, class OutputCursor>
+        std::pair<InputCursor, OutputCursor>
+        impl_contiguous(InputCursor in_cur, OutputCursor out_cur, std::true_type) const
+        {
+            return details::memmove_forward(std::move(in_cur), std::move(out_cur));
+        }
+
+        template <class InputCursor, class OutputCursor>
+        std::pair<InputCursor, OutputCursor>
+        impl_contiguous(InputCursor in_cur, OutputCursor out_cur, std::false_type) const
+        {
+            return this->impl(std::move(in_cur), std::move(out_cur),
+                              generic_layout_tag{}, generic_layout_tag{});
+        }
+
+        template <class SegmentedCursor, class OutputCursor, class OutputLayout>
+        std::pair<SegmentedCursor, OutputCursor>
+        impl(SegmentedCursor in_cur, OutputCursor out_cur, segmented_layout_tag, OutputLayout) const
+        {
+            for(auto s = ::sayan::segments(in_cur); !!s && !!out_cur; ++ s)
+            {
+                auto r = this->impl(*s, std::move(out_cur));
+
+                in_cur += details::traversed_size(r.first);
+                out_cur = std::move(r.second);
+            }
+
+            return {std::move(in_cur), std::move(out_cur)};
+        }
+
+        template <class InputCursor, class SegmentedCursor>
+        std::pair<InputCursor, SegmentedCursor>
+        impl(InputCursor in_cur, SegmentedCursor out_cur, generic_layout_tag, segmented_layout_tag) const
+        {
+            for(auto s = ::sayan::segments(out_cur); !!s && !!in_cur; ++ s)
+            {
+                auto r = this->impl(std::move(in_cur), *s);
+
+                in_cur = std::move(r.first);
+                out_cur += details::traversed_size(r.second);
+            }
+
+            return {std::move(in_cur), std::move(out_cur)};
+        }
     };
 
     struct move_fn
     {
+    public:
         template <class InputSequence, class OutputSequence>
         std::pair<safe_cursor_type_t<InputSequence>,
                   safe_cursor_type_t<OutputSequence>>
@@ -437,17 +1737,35 @@ inline namespace v1
             auto in_cur = sayan::cursor_fwd<InputSequence>(in);
             auto out_cur = sayan::cursor_fwd<OutputSequence>(out);
 
+            using Memmove = details::is_memmove_compatible_cursors<decltype(in_cur), decltype(out_cur)>;
+
+            return this->impl(std::move(in_cur), std::move(out_cur), Memmove{});
+        }
+
+    private:
+        template <class InputCursor, class OutputCursor>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, std::false_type) const
+        {
             for(; !!in_cur && !!out_cur; ++ in_cur)
             {
-                out_cur << std::move(*in_cur);
+                out_cur << ::sayan::cursor_move(in_cur);
             }
 
             return {std::move(in_cur), std::move(out_cur)};
         }
+
+        template <class InputCursor, class OutputCursor>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, std::true_type) const
+        {
+            return details::memmove_forward(std::move(in_cur), std::move(out_cur));
+        }
     };
 
     struct transform_fn
     {
+    public:
         template <class InputSequence, class OutputSequence, class UnaryFunction>
         std::pair<safe_cursor_type_t<InputSequence>,
                   safe_cursor_type_t<OutputSequence>>
@@ -482,35 +1800,243 @@ inline namespace v1
                 out_cur << fun(*in1_cur, *in2_cur);
             }
 
-            using Result = std::tuple<safe_cursor_type_t<InputSequence1>,
-                                      safe_cursor_type_t<InputSequence2>,
-                                      safe_cursor_type_t<OutputSequence>>;
-            return Result{std::move(in1_cur), std::move(in2_cur), std::move(out_cur)};
+            using Result = std::tuple<safe_cursor_type_t<InputSequence1>,
+                                      safe_cursor_type_t<InputSequence2>,
+                                      safe_cursor_type_t<OutputSequence>>;
+            return Result{std::move(in1_cur), std::move(in2_cur), std::move(out_cur)};
+        }
+    };
+
+    /// @cond false
+    namespace details
+    {
+        /* Заполняемое значение преобразуется в тип элемента один раз, после
+        чего копируется побайтно. Результат совпадает с присваиванием
+        *cur = value, только если значение имеет тот же тип, что и элемент,
+        или оба типа арифметические: для классов operator=(Value) может
+        отличаться от конструктора.
+        */
+        template <class T, class Value>
+        struct is_trivial_fill_compatible
+         : std::integral_constant<bool, !std::is_const<T>::value
+                                        && !std::is_volatile<T>::value
+                                        && std::is_trivially_copyable<T>::value
+                                        && std::is_copy_assignable<T>::value
+                                        && (std::is_same<std::remove_cv_t<Value>, T>::value
+                                            || (std::is_arithmetic<T>::value
+                                                && std::is_arithmetic<Value>::value))>
+        {};
+
+        /* Заполнения, превышающие этот размер (в байтах), значительно больше
+        кэша последнего уровня, поэтому выполняются с помощью записи в обход
+        кэша, чтобы не вытеснять из него рабочие данные.
+        */
+        constexpr std::size_t nontemporal_fill_threshold = std::size_t(1) << 26;
+
+        template <class T, class Value>
+        void fill_contiguous(T * first, T * last, Value const & value, std::false_type)
+        {
+            for(; first != last; ++ first)
+            {
+                *first = value;
+            }
+        }
+
+        /* Значение копируется в локальную переменную: запись в последовательность
+        не может его изменить, поэтому компилятор может развернуть цикл и
+        использовать векторные инструкции.
+        */
+        template <class T>
+        void fill_trivial(T * first, T * last, T const value, std::false_type)
+        {
+            if(sizeof(T) == 1)
+            {
+                auto const n = static_cast<std::size_t>(last - first);
+
+                if(n != 0)
+                {
+                    unsigned char byte;
+                    std::memcpy(&byte, &value, 1);
+                    std::memset(static_cast<void *>(first), byte, n);
+                }
+                return;
+            }
+
+            for(; first != last; ++ first)
+            {
+                *first = value;
+            }
+        }
+
+#if defined(__SSE2__)
+        /* Запись блоков по 16 байт: оптимизатор не всегда векторизует цикл
+        заполнения сам (например, GCC при -O2)
+        */
+        template <class T>
+        void fill_broadcast(T * first, T * last, T const value)
+        {
+            auto const block = details::broadcast_block(value);
+
+            auto const n_blocks = static_cast<std::size_t>(last - first) * sizeof(T) / 16;
+            auto const out = reinterpret_cast<__m128i *>(first);
+
+            std::size_t i = 0;
+            for(; i + 4 <= n_blocks; i += 4)
+            {
+                _mm_storeu_si128(out + i, block);
+                _mm_storeu_si128(out + i + 1, block);
+                _mm_storeu_si128(out + i + 2, block);
+                _mm_storeu_si128(out + i + 3, block);
+            }
+
+            for(; i != n_blocks; ++ i)
+            {
+                _mm_storeu_si128(out + i, block);
+            }
+
+            first += n_blocks * (16 / sizeof(T));
+
+            for(; first != last; ++ first)
+            {
+                *first = value;
+            }
+        }
+
+        /* Запись в обход кэша. Начало выравнивается до 16 байт поэлементно,
+        что возможно, так как размер элемента совпадает с его выравниванием.
+        */
+        template <class T>
+        void fill_nontemporal(T * first, T * last, T const value)
+        {
+            auto const block = details::broadcast_block(value);
+
+            for(; first != last && reinterpret_cast<std::uintptr_t>(first) % 16 != 0; ++ first)
+            {
+                *first = value;
+            }
+
+            auto const n_blocks = static_cast<std::size_t>(last - first) * sizeof(T) / 16;
+            auto const out = reinterpret_cast<__m128i *>(first);
+
+            for(std::size_t i = 0; i != n_blocks; ++ i)
+            {
+                _mm_stream_si128(out + i, block);
+            }
+
+            _mm_sfence();
+
+            first += n_blocks * (16 / sizeof(T));
+
+            for(; first != last; ++ first)
+            {
+                *first = value;
+            }
+        }
+
+        template <class T>
+        void fill_trivial(T * first, T * last, T const value, std::true_type)
+        {
+            if(static_cast<std::size_t>(last - first) * sizeof(T) >= nontemporal_fill_threshold)
+            {
+                details::fill_nontemporal(first, last, value);
+            }
+            else if(sizeof(T) == 1)
+            {
+                details::fill_trivial(first, last, value, std::false_type{});
+            }
+            else
+            {
+                details::fill_broadcast(first, last, value);
+            }
+        }
+#endif
+
+        template <class T, class Value>
+        void fill_contiguous(T * first, T * last, Value const & value, std::true_type)
+        {
+            T const x(value);
+
+#if defined(__SSE2__)
+            details::fill_trivial(first, last, x, is_simd_block_compatible<T>{});
+#else
+            details::fill_trivial(first, last, x, std::false_type{});
+#endif
         }
-    };
+    }
+    // namespace details
+    /// @endcond
 
     struct fill_fn
     {
+    public:
         template <class OutputSequence, class T>
         void operator()(OutputSequence && out, T const & value) const
         {
             auto cur = sayan::cursor_fwd<OutputSequence>(out);
 
+            this->impl(std::move(cur), value, cursor_layout_t<decltype(cur)>{});
+        }
+
+    private:
+        template <class OutputCursor, class T>
+        void impl(OutputCursor cur, T const & value, generic_layout_tag) const
+        {
             for(; !!cur; ++ cur)
             {
                 *cur = value;
             }
         }
+
+        template <class ContiguousCursor, class T>
+        void impl(ContiguousCursor cur, T const & value, contiguous_layout_tag) const
+        {
+            if(!cur)
+            {
+                return;
+            }
+
+            auto const first = ::sayan::cursor_data(cur);
+            auto const last = first + cur.size();
+
+            using Element = std::remove_pointer_t<decltype(first)>;
+
+            details::fill_contiguous(first, last, value,
+                                     details::is_trivial_fill_compatible<Element, T>{});
+        }
+
+        template <class SegmentedCursor, class T>
+        void impl(SegmentedCursor cur, T const & value, segmented_layout_tag) const
+        {
+            for(auto s = ::sayan::segments(cur); !!s; ++ s)
+            {
+                (*this)(*s, value);
+            }
+        }
     };
 
     struct fill_n_fn
     {
+    public:
         template <class OutputSequence, class Size, class T>
         safe_cursor_type_t<OutputSequence>
         operator()(OutputSequence && out, Size n, T const & value) const
         {
             auto cur = sayan::cursor_fwd<OutputSequence>(out);
 
+            return this->impl(std::move(cur), n, value, is_sized_cursor<decltype(cur)>{});
+        }
+
+    private:
+        template <class OutputCursor, class Size, class T>
+        OutputCursor impl(OutputCursor cur, Size n, T const & value, std::false_type) const
+        {
+            return this->impl_unsized(std::move(cur), n, value, is_cursor<OutputCursor>{});
+        }
+
+        // Курсор вывода, для которого определены только проверка исчерпания и запись
+        template <class OutputCursor, class Size, class T>
+        OutputCursor impl_unsized(OutputCursor cur, Size n, T const & value, std::false_type) const
+        {
             for(; !!cur && n > 0; -- n)
             {
                 cur << value;
@@ -518,6 +2044,30 @@ inline namespace v1
 
             return cur;
         }
+
+        template <class OutputCursor, class Size, class T>
+        OutputCursor impl_unsized(OutputCursor cur, Size n, T const & value, std::true_type) const
+        {
+            auto c_cur = ::sayan::counted_cursor(std::move(cur), details::max_count<OutputCursor>(n));
+
+            for(; !!c_cur; ++ c_cur)
+            {
+                *c_cur = value;
+            }
+
+            return std::move(c_cur).base();
+        }
+
+        template <class OutputCursor, class Size, class T>
+        OutputCursor impl(OutputCursor cur, Size n, T const & value, std::true_type) const
+        {
+            auto const m = details::clamp_count(n, cur.size());
+
+            ::sayan::fill_fn{}(::sayan::counted_cursor(cur, m), value);
+
+            cur += m;
+            return cur;
+        }
     };
 
     struct generate_fn
@@ -536,12 +2086,26 @@ inline namespace v1
 
     struct generate_n_fn
     {
+    public:
         template <class OutputSequence, class Size, class Generator>
         safe_cursor_type_t<OutputSequence>
         operator()(OutputSequence && out, Size n, Generator gen) const
         {
             auto cur = sayan::cursor_fwd<OutputSequence>(out);
 
+            return this->impl(std::move(cur), n, gen, is_sized_cursor<decltype(cur)>{});
+        }
+
+    private:
+        template <class OutputCursor, class Size, class Generator>
+        OutputCursor impl(OutputCursor cur, Size n, Generator & gen, std::false_type) const
+        {
+            return this->impl_unsized(std::move(cur), n, gen, is_cursor<OutputCursor>{});
+        }
+
+        template <class OutputCursor, class Size, class Generator>
+        OutputCursor impl_unsized(OutputCursor cur, Size n, Generator & gen, std::false_type) const
+        {
             for(; !!cur && n > 0; -- n)
             {
                 cur << gen();
@@ -549,10 +2113,128 @@ inline namespace v1
 
             return cur;
         }
+
+        template <class OutputCursor, class Size, class Generator>
+        OutputCursor impl_unsized(OutputCursor cur, Size n, Generator & gen, std::true_type) const
+        {
+            auto c_cur = ::sayan::counted_cursor(std::move(cur), details::max_count<OutputCursor>(n));
+
+            for(; !!c_cur; ++ c_cur)
+            {
+                *c_cur = gen();
+            }
+
+            return std::move(c_cur).base();
+        }
+
+        template <class OutputCursor, class Size, class Generator>
+        OutputCursor impl(OutputCursor cur, Size n, Generator & gen, std::true_type) const
+        {
+            auto const m = details::clamp_count(n, cur.size());
+
+            for(auto c_cur = ::sayan::counted_cursor(cur, m); !!c_cur; ++ c_cur)
+            {
+                *c_cur = gen();
+            }
+
+            cur += m;
+            return cur;
+        }
     };
 
+    /// @cond false
+    namespace details
+    {
+        /* Непрерывные последовательности арифметических значений, которые
+        алгоритмы копирования с предикатом и замены обрабатывают без ветвлений
+        по значению предиката
+        */
+        template <class T>
+        struct is_branchless_compatible
+         : std::integral_constant<bool, std::is_arithmetic<T>::value
+                                        && !std::is_const<T>::value
+                                        && !std::is_volatile<T>::value>
+        {};
+
+        template <class Cursor, bool = ::sayan::is_contiguous_cursor<Cursor>::value>
+        struct is_branchless_cursor
+         : std::false_type
+        {};
+
+        template <class Cursor>
+        struct is_branchless_cursor<Cursor, true>
+         : is_branchless_compatible<std::remove_pointer_t<::sayan::contiguous_pointer_t<Cursor>>>
+        {};
+
+        template <class InputCursor, class OutputCursor,
+                  bool = ::sayan::is_contiguous_cursor<InputCursor>::value
+                         && ::sayan::is_contiguous_cursor<OutputCursor>::value>
+        struct is_branchless_copy_cursors
+         : std::false_type
+        {};
+
+        template <class InputCursor, class OutputCursor>
+        struct is_branchless_copy_cursors<InputCursor, OutputCursor, true>
+         : std::integral_constant<bool, std::is_arithmetic<std::remove_pointer_t<::sayan::contiguous_pointer_t<InputCursor>>>::value
+                                        && !std::is_volatile<std::remove_pointer_t<::sayan::contiguous_pointer_t<InputCursor>>>::value
+                                        && is_branchless_cursor<OutputCursor>::value>
+        {};
+
+        /* Выборка блоками: элемент всегда записывается во временный буфер, а
+        позиция записи сдвигается на значение предиката. Размер блока не
+        превосходит свободного места в выходной последовательности, поэтому
+        обработка останавливается на том же элементе, что и поэлементный
+        алгоритм, а элементы выхода за пределами результата не изменяются.
+        Возвращает количество прочитанных и записанных элементов.
+        */
+        template <class T1, class T2, class UnaryPredicate>
+        std::pair<std::ptrdiff_t, std::ptrdiff_t>
+        copy_if_blocks(T1 * in, std::ptrdiff_t n, T2 * out, std::ptrdiff_t capacity,
+                       UnaryPredicate & pred)
+        {
+            constexpr std::ptrdiff_t block = 256;
+
+            std::ptrdiff_t i = 0;
+            std::ptrdiff_t j = 0;
+
+            for(; i != n && j != capacity;)
+            {
+                auto const m = std::min(block, std::min(n - i, capacity - j));
+
+                T2 buffer[block];
+                std::ptrdiff_t k = 0;
+
+                for(std::ptrdiff_t t = 0; t != m; ++ t)
+                {
+                    buffer[k] = in[i + t];
+                    k += pred(in[i + t]) ? 1 : 0;
+                }
+
+                // При обработке на месте неизменный блок не записывается
+                if(k != m || static_cast<void const *>(out + j) != static_cast<void const *>(in + i))
+                {
+                    std::memmove(out + j, buffer, static_cast<std::size_t>(k) * sizeof(T2));
+                }
+
+                i += m;
+                j += k;
+            }
+
+            return {i, j};
+        }
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Копирование элементов, удовлетворяющих предикату
+    @details Если вход и выход -- непрерывные последовательности
+    арифметических значений, выборка выполняется без ветвлений по значению
+    предиката. Если выход начинается после входа и пересекается с ним,
+    используется поэлементный алгоритм.
+    */
     struct copy_if_fn
     {
+    public:
         template <class InputSequence, class OutputSequence,
                   class UnaryPredicate>
         std::pair<safe_cursor_type_t<InputSequence>,
@@ -563,6 +2245,16 @@ inline namespace v1
             auto in_cur = ::sayan::cursor_fwd<InputSequence>(in);
             auto out_cur = ::sayan::cursor_fwd<OutputSequence>(out);
 
+            using Tag = details::is_branchless_copy_cursors<decltype(in_cur), decltype(out_cur)>;
+
+            return this->impl(std::move(in_cur), std::move(out_cur), pred, Tag{});
+        }
+
+    private:
+        template <class InputCursor, class OutputCursor, class UnaryPredicate>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, UnaryPredicate & pred, std::false_type) const
+        {
             for(; !!in_cur && !!out_cur; ++ in_cur)
             {
                 if(pred(*in_cur))
@@ -573,10 +2265,35 @@ inline namespace v1
 
             return {std::move(in_cur), std::move(out_cur)};
         }
+
+        template <class InputCursor, class OutputCursor, class UnaryPredicate>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, UnaryPredicate & pred, std::true_type) const
+        {
+            auto const in = ::sayan::cursor_data(in_cur);
+            auto const out = ::sayan::cursor_data(out_cur);
+
+            auto const n = in_cur.size();
+            auto const capacity = out_cur.size();
+
+            if(reinterpret_cast<std::uintptr_t>(out) > reinterpret_cast<std::uintptr_t>(in)
+               && details::memory_overlaps(in, in + n, out, out + capacity))
+            {
+                return this->impl(std::move(in_cur), std::move(out_cur), pred, std::false_type{});
+            }
+
+            auto const r = details::copy_if_blocks(in, n, out, capacity, pred);
+
+            in_cur += r.first;
+            out_cur += r.second;
+
+            return {std::move(in_cur), std::move(out_cur)};
+        }
     };
 
     struct copy_n_fn
     {
+    public:
         template <class InputSequence, class Size, class OutputSequence>
         std::pair<safe_cursor_type_t<InputSequence>,
                   safe_cursor_type_t<OutputSequence>>
@@ -585,41 +2302,102 @@ inline namespace v1
             auto in_cur = ::sayan::cursor_fwd<InputSequence>(in);
             auto out_cur = ::sayan::cursor_fwd<OutputSequence>(out);
 
-            for(; !!in_cur && !!out_cur && n > 0; ++ in_cur)
-            {
-                out_cur << *in_cur;
+            return this->impl(std::move(in_cur), n, std::move(out_cur),
+                              is_sized_cursor<decltype(in_cur)>{});
+        }
 
-                -- n;
-            }
+    private:
+        template <class InputCursor, class Size, class OutputCursor>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, Size n, OutputCursor out_cur, std::false_type) const
+        {
+            auto const m = details::max_count<InputCursor>(n);
 
-            return {std::move(in_cur), std::move(out_cur)};
+            auto r = ::sayan::copy_fn{}(::sayan::counted_cursor(std::move(in_cur), m),
+                                        std::move(out_cur));
+
+            return {std::move(r.first).base(), std::move(r.second)};
+        }
+
+        template <class InputCursor, class Size, class OutputCursor>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, Size n, OutputCursor out_cur, std::true_type) const
+        {
+            auto const m = details::clamp_count(n, in_cur.size());
+
+            auto r = ::sayan::copy_fn{}(::sayan::counted_cursor(std::move(in_cur), m),
+                                        std::move(out_cur));
+
+            return {std::move(r.first).base(), std::move(r.second)};
         }
     };
 
     struct copy_backward_fn
     {
+    public:
         template <class BidirectionalSequence1, class BidirectionalSequence2>
         std::pair<safe_cursor_type_t<BidirectionalSequence1>,
                   safe_cursor_type_t<BidirectionalSequence2>>
         operator()(BidirectionalSequence1 && in, BidirectionalSequence2 && out) const
         {
-            auto r = ::sayan::copy_fn{}(::sayan::make_reverse_cursor(std::forward<BidirectionalSequence1>(in)),
-                                        ::sayan::make_reverse_cursor(std::forward<BidirectionalSequence2>(out)));
+            auto in_cur = ::sayan::cursor_fwd<BidirectionalSequence1>(in);
+            auto out_cur = ::sayan::cursor_fwd<BidirectionalSequence2>(out);
+
+            using Memmove = details::is_memmove_compatible_cursors<decltype(in_cur), decltype(out_cur)>;
+
+            return this->impl(std::move(in_cur), std::move(out_cur), Memmove{});
+        }
+
+    private:
+        template <class BidirectionalCursor1, class BidirectionalCursor2>
+        std::pair<BidirectionalCursor1, BidirectionalCursor2>
+        impl(BidirectionalCursor1 in_cur, BidirectionalCursor2 out_cur, std::false_type) const
+        {
+            auto r = ::sayan::copy_fn{}(::sayan::make_reverse_cursor(std::move(in_cur)),
+                                   ::sayan::make_reverse_cursor(std::move(out_cur)));
             return {std::move(r.first).base(), std::move(r.second).base()};
         }
+
+        template <class BidirectionalCursor1, class BidirectionalCursor2>
+        std::pair<BidirectionalCursor1, BidirectionalCursor2>
+        impl(BidirectionalCursor1 in_cur, BidirectionalCursor2 out_cur, std::true_type) const
+        {
+            return details::memmove_backward(std::move(in_cur), std::move(out_cur));
+        }
     };
 
     struct move_backward_fn
     {
+    public:
         template <class BidirectionalSequence1, class BidirectionalSequence2>
         std::pair<safe_cursor_type_t<BidirectionalSequence1>,
                   safe_cursor_type_t<BidirectionalSequence2>>
         operator()(BidirectionalSequence1 && in, BidirectionalSequence2 && out) const
         {
-            auto r = ::sayan::move_fn{}(::sayan::make_reverse_cursor(std::forward<BidirectionalSequence1>(in)),
-                                        ::sayan::make_reverse_cursor(std::forward<BidirectionalSequence2>(out)));
+            auto in_cur = ::sayan::cursor_fwd<BidirectionalSequence1>(in);
+            auto out_cur = ::sayan::cursor_fwd<BidirectionalSequence2>(out);
+
+            using Memmove = details::is_memmove_compatible_cursors<decltype(in_cur), decltype(out_cur)>;
+
+            return this->impl(std::move(in_cur), std::move(out_cur), Memmove{});
+        }
+
+    private:
+        template <class BidirectionalCursor1, class BidirectionalCursor2>
+        std::pair<BidirectionalCursor1, BidirectionalCursor2>
+        impl(BidirectionalCursor1 in_cur, BidirectionalCursor2 out_cur, std::false_type) const
+        {
+            auto r = ::sayan::move_fn{}(::sayan::make_reverse_cursor(std::move(in_cur)),
+                                   ::sayan::make_reverse_cursor(std::move(out_cur)));
             return {std::move(r.first).base(), std::move(r.second).base()};
         }
+
+        template <class BidirectionalCursor1, class BidirectionalCursor2>
+        std::pair<BidirectionalCursor1, BidirectionalCursor2>
+        impl(BidirectionalCursor1 in_cur, BidirectionalCursor2 out_cur, std::true_type) const
+        {
+            return details::memmove_backward(std::move(in_cur), std::move(out_cur));
+        }
     };
 
     struct remove_copy_if_fn
@@ -654,32 +2432,67 @@ inline namespace v1
         }
     };
 
+    /** @brief Удаление элементов, удовлетворяющих предикату
+    @details Непрерывные последовательности арифметических значений
+    сжимаются блоками без ветвлений по значению предиката.
+    */
     struct remove_if_fn
     {
+    public:
         template <class ForwardSequence, class UnaryPredicate>
         safe_cursor_type_t<ForwardSequence>
         operator()(ForwardSequence && seq, UnaryPredicate pred) const
         {
-            auto out = find_if_fn{}(std::forward<ForwardSequence>(seq), pred);
+            auto cur = ::sayan::cursor_fwd<ForwardSequence>(seq);
+
+            return this->impl(std::move(cur), pred, details::is_branchless_cursor<decltype(cur)>{});
+        }
+
+    private:
+        template <class ForwardCursor, class UnaryPredicate>
+        ForwardCursor impl(ForwardCursor cur, UnaryPredicate & pred, std::false_type) const
+        {
+            auto out = find_if_fn{}(std::move(cur), pred);
 
             if(!out)
             {
                 return out;
             }
 
-            auto cur = out;
+            cur = out;
             ++ cur;
 
             for(; !!cur; ++ cur)
             {
                 if(!pred(*cur))
                 {
-                    out << std::move(*cur);
+                    out << ::sayan::cursor_move(cur);
                 }
             }
 
             return out;
         }
+
+        template <class ForwardCursor, class UnaryPredicate>
+        ForwardCursor impl(ForwardCursor cur, UnaryPredicate & pred, std::true_type) const
+        {
+            auto const first = ::sayan::cursor_data(cur);
+            auto const last = first + cur.size();
+
+            // Начальные элементы, которые остаются на месте, не переписываются
+            auto out = std::find_if(first, last, std::ref(pred));
+
+            if(out != last)
+            {
+                auto const n = last - out - 1;
+
+                auto keep = [&pred](auto & x) { return !pred(x); };
+                out += details::copy_if_blocks(out + 1, n, out, n, keep).second;
+            }
+
+            cur += out - first;
+            return cur;
+        }
     };
 
     struct remove_fn
@@ -695,13 +2508,176 @@ inline namespace v1
         }
     };
 
+    /// @cond false
+    namespace details
+    {
+        // Замена по равенству с помощью SSE2
+        template <class T, class Value>
+        struct is_simd_replace_compatible
+#if defined(__SSE2__)
+         : std::integral_constant<bool, is_simd_equality_comparable<T, Value>::value
+                                        && !std::is_const<T>::value>
+#else
+         : std::false_type
+#endif
+        {};
+
+        template <class Cursor, class Value, bool = ::sayan::is_contiguous_cursor<Cursor>::value>
+        struct is_simd_replace_cursor
+         : std::false_type
+        {};
+
+        template <class Cursor, class Value>
+        struct is_simd_replace_cursor<Cursor, Value, true>
+         : is_simd_replace_compatible<std::remove_pointer_t<::sayan::contiguous_pointer_t<Cursor>>, Value>
+        {};
+
+        template <class InputCursor, class OutputCursor, class Value,
+                  bool = ::sayan::is_contiguous_cursor<InputCursor>::value
+                         && ::sayan::is_contiguous_cursor<OutputCursor>::value>
+        struct is_simd_replace_copy_cursors
+         : std::false_type
+        {};
+
+        template <class InputCursor, class OutputCursor, class Value>
+        struct is_simd_replace_copy_cursors<InputCursor, OutputCursor, Value, true>
+         : std::integral_constant<bool, std::is_same<std::remove_cv_t<std::remove_pointer_t<::sayan::contiguous_pointer_t<InputCursor>>>,
+                                                     std::remove_pointer_t<::sayan::contiguous_pointer_t<OutputCursor>>>::value
+                                        && is_simd_replace_cursor<OutputCursor, Value>::value>
+        {};
+
+        /* Значения выбираются во временный буфер без ветвлений, а буфер
+        записывается на место блока, только если отличается от него, так что
+        блоки без замен не записываются. Предикат вызывается для каждого
+        элемента ровно один раз.
+        */
+        template <class T, class UnaryPredicate>
+        void replace_if_blocks(T * first, T * last, UnaryPredicate & pred, T const new_value)
+        {
+            constexpr auto block = static_cast<std::ptrdiff_t>(64 / sizeof(T) < 4 ? 4 : 64 / sizeof(T));
+
+            for(; last - first >= block; first += block)
+            {
+                T buffer[block];
+
+                for(std::ptrdiff_t i = 0; i != block; ++ i)
+                {
+                    T const x = first[i];
+                    buffer[i] = pred(first[i]) ? new_value : x;
+                }
+
+                if(std::memcmp(buffer, first, sizeof(buffer)) != 0)
+                {
+                    std::memcpy(first, buffer, sizeof(buffer));
+                }
+            }
+
+            for(; first != last; ++ first)
+            {
+                if(pred(*first))
+                {
+                    *first = new_value;
+                }
+            }
+        }
+
+        template <class T1, class T2, class UnaryPredicate>
+        void replace_copy_if_branchless(T1 * in, T2 * out, std::ptrdiff_t n,
+                                        UnaryPredicate & pred, T2 const new_value)
+        {
+            for(std::ptrdiff_t i = 0; i != n; ++ i)
+            {
+                T2 const x = in[i];
+                out[i] = pred(in[i]) ? new_value : x;
+            }
+        }
+
+#if defined(__SSE2__)
+        // Блоки без совпадений не записываются
+        template <class T>
+        void replace_blocks(T * first, T * last, T const old_value, T const new_value)
+        {
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(T));
+
+            auto const old_block = details::broadcast_block(old_value);
+            auto const new_block = details::broadcast_block(new_value);
+
+            for(; last - first >= lanes; first += lanes)
+            {
+                auto const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+                auto const eq = details::simd_equal_lanes<T>(x, old_block);
+
+                if(_mm_movemask_epi8(eq) != 0)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(first),
+                                     details::simd_select(eq, new_block, x));
+                }
+            }
+
+            for(; first != last; ++ first)
+            {
+                if(*first == old_value)
+                {
+                    *first = new_value;
+                }
+            }
+        }
+
+        template <class T>
+        void replace_copy_blocks(T const * in, T * out, std::ptrdiff_t n,
+                                 T const old_value, T const new_value)
+        {
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(T));
+
+            auto const old_block = details::broadcast_block(old_value);
+            auto const new_block = details::broadcast_block(new_value);
+
+            std::ptrdiff_t i = 0;
+
+            for(; n - i >= lanes; i += lanes)
+            {
+                auto const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i));
+                auto const eq = details::simd_equal_lanes<T>(x, old_block);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                                 details::simd_select(eq, new_block, x));
+            }
+
+            for(; i != n; ++ i)
+            {
+                T const x = in[i];
+                out[i] = (x == old_value) ? new_value : x;
+            }
+        }
+#endif
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Замена элементов, удовлетворяющих предикату
+    @details Непрерывные последовательности арифметических значений
+    обрабатываются блоками без ветвлений по предикату; блок записывается,
+    только если в нём есть заменяемые элементы.
+    */
     struct replace_if_fn
     {
+    public:
         template <class ForwardSequence, class UnaryPredicate, class T>
         safe_cursor_type_t<ForwardSequence>
         operator()(ForwardSequence && seq, UnaryPredicate pred, T const & new_value) const
         {
             auto cur = ::sayan::cursor_fwd<ForwardSequence>(seq);
+
+            using Tag = details::is_branchless_cursor<decltype(cur)>;
+
+            return this->impl(std::move(cur), pred, new_value, Tag{});
+        }
+
+    private:
+        template <class ForwardCursor, class UnaryPredicate, class T>
+        ForwardCursor
+        impl(ForwardCursor cur, UnaryPredicate & pred, T const & new_value, std::false_type) const
+        {
             for(; !!cur; ++ cur)
             {
                 if(pred(*cur))
@@ -711,24 +2687,82 @@ inline namespace v1
             }
             return cur;
         }
+
+        template <class ForwardCursor, class UnaryPredicate, class T>
+        ForwardCursor
+        impl(ForwardCursor cur, UnaryPredicate & pred, T const & new_value, std::true_type) const
+        {
+            auto const first = ::sayan::cursor_data(cur);
+            using Element = std::remove_pointer_t<decltype(first)>;
+
+            details::replace_if_blocks(first, first + cur.size(), pred,
+                                       static_cast<Element>(new_value));
+
+            cur += cur.size();
+            return cur;
+        }
     };
 
+    /** @brief Замена элементов, равных заданному значению
+    @details Для непрерывных последовательностей арифметических значений
+    используется сравнение блоков по 16 байт с помощью SSE2 и выбор по маске;
+    блоки без совпадений не записываются.
+    */
     struct replace_fn
     {
+    public:
         template <class ForwardSequence, class T>
         safe_cursor_type_t<ForwardSequence>
         operator()(ForwardSequence && seq, T const & old_value, T const & new_value) const
         {
             auto cur = ::sayan::cursor_fwd<ForwardSequence>(seq);
+
+            using Tag = details::is_simd_replace_cursor<decltype(cur), T>;
+
+            return this->impl(std::move(cur), old_value, new_value, Tag{});
+        }
+
+    private:
+        template <class ForwardCursor, class T>
+        ForwardCursor
+        impl(ForwardCursor cur, T const & old_value, T const & new_value, std::false_type) const
+        {
             using Ref = decltype(*cur);
             return ::sayan::replace_if_fn{}(std::move(cur),
                                             [&old_value](Ref x) { return x == old_value; },
                                             new_value);
         }
+
+#if defined(__SSE2__)
+        template <class ForwardCursor, class T>
+        ForwardCursor
+        impl(ForwardCursor cur, T const & old_value, T const & new_value, std::true_type) const
+        {
+            auto const first = ::sayan::cursor_data(cur);
+            using Element = std::remove_pointer_t<decltype(first)>;
+
+            Element const x(old_value);
+
+            // Значение, не представимое в типе элементов, не равно ни одному из них
+            if(x == old_value)
+            {
+                details::replace_blocks(first, first + cur.size(), x,
+                                        static_cast<Element>(new_value));
+            }
+
+            cur += cur.size();
+            return cur;
+        }
+#endif
     };
 
+    /** @brief Копирование с заменой элементов, удовлетворяющих предикату
+    @details Если вход и выход -- непрерывные последовательности
+    арифметических значений, значение для записи выбирается без ветвления.
+    */
     struct replace_copy_if_fn
     {
+    public:
         template <class InputSequence, class OutputSequence,
                   class UnaryPredicate, class T>
         std::pair<safe_cursor_type_t<InputSequence>,
@@ -739,6 +2773,17 @@ inline namespace v1
             auto in_cur = ::sayan::cursor_fwd<InputSequence>(in);
             auto out_cur = ::sayan::cursor_fwd<OutputSequence>(out);
 
+            using Tag = details::is_branchless_copy_cursors<decltype(in_cur), decltype(out_cur)>;
+
+            return this->impl(std::move(in_cur), std::move(out_cur), pred, new_value, Tag{});
+        }
+
+    private:
+        template <class InputCursor, class OutputCursor, class UnaryPredicate, class T>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur,
+             UnaryPredicate & pred, T const & new_value, std::false_type) const
+        {
             for(; !!in_cur && !!out_cur; ++in_cur)
             {
                 if(pred(*in_cur))
@@ -753,10 +2798,35 @@ inline namespace v1
 
             return {std::move(in_cur), std::move(out_cur)};
         }
+
+        template <class InputCursor, class OutputCursor, class UnaryPredicate, class T>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur,
+             UnaryPredicate & pred, T const & new_value, std::true_type) const
+        {
+            auto const n = std::min<std::ptrdiff_t>(in_cur.size(), out_cur.size());
+            auto const out = ::sayan::cursor_data(out_cur);
+            using Element = std::remove_pointer_t<decltype(out)>;
+
+            details::replace_copy_if_branchless(::sayan::cursor_data(in_cur), out, n,
+                                                pred, static_cast<Element>(new_value));
+
+            in_cur += n;
+            out_cur += n;
+
+            return {std::move(in_cur), std::move(out_cur)};
+        }
     };
 
+    /** @brief Копирование с заменой элементов, равных заданному значению
+    @details Для непрерывных последовательностей арифметических значений
+    одного типа используется сравнение блоков с помощью SSE2 и выбор по маске.
+    Если выход начинается после входа и пересекается с ним, используется
+    поэлементный алгоритм.
+    */
     struct replace_copy_fn
     {
+    public:
         template <class InputSequence, class OutputSequence, class T>
         std::pair<safe_cursor_type_t<InputSequence>,
                   safe_cursor_type_t<OutputSequence>>
@@ -764,17 +2834,134 @@ inline namespace v1
                    T const & old_value, T const & new_value) const
         {
             auto in_cur = ::sayan::cursor_fwd<InputSequence>(in);
+            auto out_cur = ::sayan::cursor_fwd<OutputSequence>(out);
+
+            using Tag = details::is_simd_replace_copy_cursors<decltype(in_cur), decltype(out_cur), T>;
+
+            return this->impl(std::move(in_cur), std::move(out_cur), old_value, new_value, Tag{});
+        }
+
+    private:
+        template <class InputCursor, class OutputCursor, class T>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur,
+             T const & old_value, T const & new_value, std::false_type) const
+        {
             using Ref = decltype(*in_cur);
 
             auto impl = ::sayan::replace_copy_if_fn{};
-            return impl(std::move(in_cur), std::forward<OutputSequence>(out),
+            return impl(std::move(in_cur), std::move(out_cur),
                         [&old_value](Ref x) { return x == old_value; },
                         new_value);
         }
+
+#if defined(__SSE2__)
+        template <class InputCursor, class OutputCursor, class T>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur,
+             T const & old_value, T const & new_value, std::true_type) const
+        {
+            auto const n = std::min<std::ptrdiff_t>(in_cur.size(), out_cur.size());
+            auto const in = ::sayan::cursor_data(in_cur);
+            auto const out = ::sayan::cursor_data(out_cur);
+
+            using Element = std::remove_pointer_t<decltype(out)>;
+
+            Element const x(old_value);
+
+            if(reinterpret_cast<std::uintptr_t>(out) > reinterpret_cast<std::uintptr_t>(in)
+               && details::memory_overlaps(in, in + n, out, out + n))
+            {
+                return this->impl(std::move(in_cur), std::move(out_cur),
+                                  old_value, new_value, std::false_type{});
+            }
+
+            if(x == old_value)
+            {
+                details::replace_copy_blocks(in, out, n, x, static_cast<Element>(new_value));
+            }
+            else if(n != 0)
+            {
+                std::memmove(out, in, static_cast<std::size_t>(n) * sizeof(Element));
+            }
+
+            in_cur += n;
+            out_cur += n;
+
+            return {std::move(in_cur), std::move(out_cur)};
+        }
+#endif
     };
 
+    /// @cond false
+    namespace details
+    {
+        template <class Cursor1, class Cursor2,
+                  bool = ::sayan::is_contiguous_cursor<Cursor1>::value
+                         && ::sayan::is_contiguous_cursor<Cursor2>::value>
+        struct is_bitwise_swappable_cursors
+         : std::false_type
+        {};
+
+        template <class Cursor1, class Cursor2>
+        struct is_bitwise_swappable_cursors<Cursor1, Cursor2, true>
+#if defined(__SSE2__)
+         : std::integral_constant<bool, std::is_same<::sayan::contiguous_pointer_t<Cursor1>,
+                                                     ::sayan::contiguous_pointer_t<Cursor2>>::value
+                                        && std::is_trivially_copyable<std::remove_pointer_t<::sayan::contiguous_pointer_t<Cursor1>>>::value
+                                        && !std::is_const<std::remove_pointer_t<::sayan::contiguous_pointer_t<Cursor1>>>::value
+                                        && !std::is_volatile<std::remove_pointer_t<::sayan::contiguous_pointer_t<Cursor1>>>::value>
+#else
+         : std::false_type
+#endif
+        {};
+
+#if defined(__SSE2__)
+        // Обмен содержимого непересекающихся областей памяти блоками по 32 байта
+        inline void swap_bytes(unsigned char * x, unsigned char * y, std::size_t n)
+        {
+            auto const load = [](unsigned char const * p)
+            {
+                return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+            };
+
+            auto const store = [](unsigned char * p, __m128i value)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(p), value);
+            };
+
+            for(; n >= 32; n -= 32, x += 32, y += 32)
+            {
+                auto const x0 = load(x);
+                auto const x1 = load(x + 16);
+                auto const y0 = load(y);
+                auto const y1 = load(y + 16);
+
+                store(x, y0);
+                store(x + 16, y1);
+                store(y, x0);
+                store(y + 16, x1);
+            }
+
+            for(; n != 0; -- n, ++ x, ++ y)
+            {
+                auto const tmp = *x;
+                *x = *y;
+                *y = tmp;
+            }
+        }
+#endif
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Обмен элементов двух последовательностей
+    @details Непересекающиеся непрерывные последовательности тривиально
+    копируемых значений обмениваются блоками памяти с помощью SSE2.
+    */
     struct swap_ranges_fn
     {
+    public:
         template <class ForwardSequence1, class ForwardSequence2>
         std::pair<safe_cursor_type_t<ForwardSequence1>, safe_cursor_type_t<ForwardSequence2>>
         operator()(ForwardSequence1 && s1, ForwardSequence2 && s2) const
@@ -782,6 +2969,16 @@ inline namespace v1
             auto cur1 = ::sayan::cursor_fwd<ForwardSequence1>(s1);
             auto cur2 = ::sayan::cursor_fwd<ForwardSequence2>(s2);
 
+            using Tag = details::is_bitwise_swappable_cursors<decltype(cur1), decltype(cur2)>;
+
+            return this->impl(std::move(cur1), std::move(cur2), Tag{});
+        }
+
+    private:
+        template <class ForwardCursor1, class ForwardCursor2>
+        std::pair<ForwardCursor1, ForwardCursor2>
+        impl(ForwardCursor1 cur1, ForwardCursor2 cur2, std::false_type) const
+        {
             for(;!!cur1 && !!cur2; ++ cur1, ++ cur2)
             {
                 ::sayan::cursor_swap(cur1, cur2);
@@ -789,31 +2986,232 @@ inline namespace v1
 
             return {std::move(cur1), std::move(cur2)};
         }
+
+#if defined(__SSE2__)
+        template <class ForwardCursor1, class ForwardCursor2>
+        std::pair<ForwardCursor1, ForwardCursor2>
+        impl(ForwardCursor1 cur1, ForwardCursor2 cur2, std::true_type) const
+        {
+            auto const n = std::min<std::ptrdiff_t>(cur1.size(), cur2.size());
+            auto const first1 = ::sayan::cursor_data(cur1);
+            auto const first2 = ::sayan::cursor_data(cur2);
+
+            if(details::memory_overlaps(first1, first1 + n, first2, first2 + n))
+            {
+                return this->impl(std::move(cur1), std::move(cur2), std::false_type{});
+            }
+
+            details::swap_bytes(reinterpret_cast<unsigned char *>(first1),
+                                reinterpret_cast<unsigned char *>(first2),
+                                static_cast<std::size_t>(n) * sizeof(*first1));
+
+            cur1 += n;
+            cur2 += n;
+
+            return {std::move(cur1), std::move(cur2)};
+        }
+#endif
     };
 
+    /// @cond false
+    namespace details
+    {
+        template <class T>
+        struct is_simd_reverse_compatible
+#if defined(__SSE2__)
+         : std::integral_constant<bool, std::is_trivially_copyable<T>::value
+                                        && !std::is_const<T>::value
+                                        && !std::is_volatile<T>::value
+                                        && 16 % sizeof(T) == 0>
+#else
+         : std::false_type
+#endif
+        {};
+
+        template <class Cursor, bool = ::sayan::is_contiguous_cursor<Cursor>::value>
+        struct is_simd_reversible_cursor
+         : std::false_type
+        {};
+
+        template <class Cursor>
+        struct is_simd_reversible_cursor<Cursor, true>
+         : is_simd_reverse_compatible<std::remove_pointer_t<::sayan::contiguous_pointer_t<Cursor>>>
+        {};
+
+        template <class InputCursor, class OutputCursor,
+                  bool = ::sayan::is_contiguous_cursor<InputCursor>::value
+                         && ::sayan::is_contiguous_cursor<OutputCursor>::value>
+        struct is_simd_reverse_copyable_cursors
+         : std::false_type
+        {};
+
+        template <class InputCursor, class OutputCursor>
+        struct is_simd_reverse_copyable_cursors<InputCursor, OutputCursor, true>
+         : std::integral_constant<bool, std::is_same<std::remove_cv_t<std::remove_pointer_t<::sayan::contiguous_pointer_t<InputCursor>>>,
+                                                     std::remove_pointer_t<::sayan::contiguous_pointer_t<OutputCursor>>>::value
+                                        && is_simd_reversible_cursor<OutputCursor>::value>
+        {};
+
+#if defined(__SSE2__)
+        // Перестановка элементов блока в обратном порядке
+        inline __m128i simd_reverse_lanes(__m128i x, std::integral_constant<std::size_t, 16>)
+        {
+            return x;
+        }
+
+        inline __m128i simd_reverse_lanes(__m128i x, std::integral_constant<std::size_t, 8>)
+        {
+            return _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+        }
+
+        inline __m128i simd_reverse_lanes(__m128i x, std::integral_constant<std::size_t, 4>)
+        {
+            return _mm_shuffle_epi32(x, _MM_SHUFFLE(0, 1, 2, 3));
+        }
+
+        inline __m128i simd_reverse_lanes(__m128i x, std::integral_constant<std::size_t, 2>)
+        {
+            x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(0, 1, 2, 3));
+            x = _mm_shufflehi_epi16(x, _MM_SHUFFLE(0, 1, 2, 3));
+            return _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+        }
+
+        inline __m128i simd_reverse_lanes(__m128i x, std::integral_constant<std::size_t, 1>)
+        {
+#if defined(__SSSE3__)
+            auto const order = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            return _mm_shuffle_epi8(x, order);
+#else
+            // Без SSSE3 переставляются 16-битные слова, а затем байты внутри слов
+            x = simd_reverse_lanes(x, std::integral_constant<std::size_t, 2>{});
+            return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+#endif
+        }
+
+        template <class T>
+        __m128i simd_load_reversed(T const * p)
+        {
+            auto const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+            return simd_reverse_lanes(x, std::integral_constant<std::size_t, sizeof(T)>{});
+        }
+
+        /* Блоки загружаются с обоих концов, элементы в них переставляются, и
+        блоки записываются на места друг друга. Средняя часть, меньшая двух
+        блоков, обращается поэлементно.
+        */
+        template <class T>
+        void reverse_blocks(T * first, T * last)
+        {
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(T));
+
+            for(; last - first >= 2 * lanes; first += lanes)
+            {
+                last -= lanes;
+
+                auto const x = simd_load_reversed(first);
+                auto const y = simd_load_reversed(last);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(first), y);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(last), x);
+            }
+
+            std::reverse(first, last);
+        }
+
+        template <class T>
+        void reverse_copy_blocks(T const * first, T const * last, T * out)
+        {
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(T));
+
+            for(; last - first >= lanes; out += lanes)
+            {
+                last -= lanes;
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out), simd_load_reversed(last));
+            }
+
+            std::reverse_copy(first, last, out);
+        }
+#endif
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Копирование элементов в обратном порядке
+    @details Непрерывные последовательности тривиально копируемых значений,
+    размер которых делит 16 байт, обращаются поблочно с помощью SSE2 (для байтов
+    при наличии SSSE3 используется pshufb). Если вход и выход пересекаются,
+    используется поэлементный алгоритм.
+    */
     struct reverse_copy_fn
     {
+    public:
         template <class BidirectionalSequence, class OutputSequence>
         std::pair<safe_cursor_type_t<BidirectionalSequence>, safe_cursor_type_t<OutputSequence>>
         operator()(BidirectionalSequence && in_seq, OutputSequence && out_seq) const
         {
             auto in = ::sayan::cursor_fwd<BidirectionalSequence>(in_seq);
+            auto out = ::sayan::cursor_fwd<OutputSequence>(out_seq);
+
+            using Kernel = details::is_simd_reverse_copyable_cursors<decltype(in), decltype(out)>;
 
-            auto r = ::sayan::copy_fn{}(::sayan::make_reverse_cursor(std::move(in)),
-                                        ::std::forward<OutputSequence>(out_seq));
+            return this->impl(std::move(in), std::move(out), Kernel{});
+        }
+
+    private:
+        template <class BidirectionalCursor, class OutputCursor>
+        std::pair<BidirectionalCursor, OutputCursor>
+        impl(BidirectionalCursor in, OutputCursor out, std::false_type) const
+        {
+            auto r = ::sayan::copy_fn{}(::sayan::make_reverse_cursor(std::move(in)), std::move(out));
 
             return {std::move(r.first).base(), std::move(r.second)};
         }
+
+#if defined(__SSE2__)
+        template <class BidirectionalCursor, class OutputCursor>
+        std::pair<BidirectionalCursor, OutputCursor>
+        impl(BidirectionalCursor in, OutputCursor out, std::true_type) const
+        {
+            auto const n = std::min<std::ptrdiff_t>(in.size(), out.size());
+            auto const last = ::sayan::cursor_data(in) + in.size();
+            auto const result = ::sayan::cursor_data(out);
+
+            if(details::memory_overlaps(last - n, last, result, result + n))
+            {
+                return this->impl(std::move(in), std::move(out), std::false_type{});
+            }
+
+            details::reverse_copy_blocks(last - n, last, result);
+
+            in.drop(::sayan::back, n);
+            out += n;
+
+            return {std::move(in), std::move(out)};
+        }
+#endif
     };
 
+    /** @brief Обращение порядка элементов
+    @details Для непрерывных последовательностей тривиально копируемых
+    значений, размер которых делит 16 байт, используется блочное обращение с
+    помощью SSE2.
+    */
     struct reverse_fn
     {
+    public:
         template <class BidirectionalSequence>
         void
         operator()(BidirectionalSequence && seq) const
         {
             auto cur = ::sayan::cursor_fwd<BidirectionalSequence>(seq);
 
+            this->impl(std::move(cur), details::is_simd_reversible_cursor<decltype(cur)>{});
+        }
+
+    private:
+        template <class BidirectionalCursor>
+        void impl(BidirectionalCursor cur, std::false_type) const
+        {
             for(; !!cur;)
             {
                 auto p = ::sayan::next(cur);
@@ -830,8 +3228,100 @@ inline namespace v1
                 cur = p;
             }
         }
+
+#if defined(__SSE2__)
+        template <class BidirectionalCursor>
+        void impl(BidirectionalCursor cur, std::true_type) const
+        {
+            auto const first = ::sayan::cursor_data(cur);
+
+            details::reverse_blocks(first, first + cur.size());
+        }
+#endif
     };
 
+    /// @cond false
+    namespace details
+    {
+        template <class Cursor, bool = ::sayan::is_contiguous_cursor<Cursor>::value>
+        struct is_bitwise_rotatable_cursor
+         : std::false_type
+        {};
+
+        template <class Cursor>
+        struct is_bitwise_rotatable_cursor<Cursor, true>
+         : std::integral_constant<bool, std::is_trivially_copyable<std::remove_pointer_t<::sayan::contiguous_pointer_t<Cursor>>>::value
+                                        && !std::is_const<std::remove_pointer_t<::sayan::contiguous_pointer_t<Cursor>>>::value
+                                        && !std::is_volatile<std::remove_pointer_t<::sayan::contiguous_pointer_t<Cursor>>>::value>
+        {};
+
+        template <class T>
+        void reverse_contiguous(T * first, T * last, std::false_type)
+        {
+            std::reverse(first, last);
+        }
+
+#if defined(__SSE2__)
+        template <class T>
+        void reverse_contiguous(T * first, T * last, std::true_type)
+        {
+            details::reverse_blocks(first, last);
+        }
+#endif
+
+        /* Если меньшая из частей помещается в буфер на стеке, она сохраняется
+        в нём, а большая часть сдвигается с помощью memmove. Иначе выполняется
+        поворот через три обращения, которые используют блочное обращение.
+        */
+        template <class T>
+        void rotate_contiguous(T * first, T * middle, T * last)
+        {
+            constexpr std::size_t buffer_size = 512;
+
+            auto const left = static_cast<std::size_t>(middle - first);
+            auto const right = static_cast<std::size_t>(last - middle);
+
+            if(left == 0 || right == 0)
+            {
+                return;
+            }
+
+            if(std::min(left, right) * sizeof(T) <= buffer_size)
+            {
+                alignas(T) unsigned char buffer[buffer_size];
+
+                if(left <= right)
+                {
+                    std::memcpy(buffer, first, left * sizeof(T));
+                    std::memmove(first, middle, right * sizeof(T));
+                    std::memcpy(first + right, buffer, left * sizeof(T));
+                }
+                else
+                {
+                    std::memcpy(buffer, middle, right * sizeof(T));
+                    std::memmove(first + right, first, left * sizeof(T));
+                    std::memcpy(first, buffer, right * sizeof(T));
+                }
+
+                return;
+            }
+
+            using Tag = is_simd_reverse_compatible<T>;
+
+            details::reverse_contiguous(first, middle, Tag{});
+            details::reverse_contiguous(middle, last, Tag{});
+            details::reverse_contiguous(first, last, Tag{});
+        }
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Циклический сдвиг
+    @details Курсор задаёт точку поворота: пройденная часть перемещается в
+    конец. Для непрерывных последовательностей тривиально копируемых значений
+    небольшие сдвиги выполняются через буфер и memmove, а остальные -- тремя
+    блочными обращениями.
+    */
     struct rotate_fn
     {
     public:
@@ -852,13 +3342,35 @@ inline namespace v1
                 return cur1;
             }
 
-            auto cur2 = cur;
+            return this->impl(std::move(cur1), std::move(cur),
+                              details::is_bitwise_rotatable_cursor<ForwardCursor>{});
+        }
+
+    private:
+        template <class ForwardCursor>
+        ForwardCursor impl(ForwardCursor cur1, ForwardCursor cur, std::false_type) const
+        {
+            auto cur2 = std::move(cur);
             cur2.forget(sayan::front_fn{});
 
             return this->rotate_forward_nontrivial(std::move(cur1), std::move(cur2));
         }
 
-    private:
+        template <class ForwardCursor>
+        ForwardCursor impl(ForwardCursor cur1, ForwardCursor cur, std::true_type) const
+        {
+            auto const middle = ::sayan::cursor_data(cur);
+            auto const first = middle - cur1.size();
+            auto const n2 = cur.size();
+
+            details::rotate_contiguous(first, middle, middle + n2);
+
+            cur1.splice(std::move(cur));
+            cur1 += n2;
+
+            return cur1;
+        }
+
         template <class ForwardCursor>
         void rotate_forward_step(ForwardCursor & cur1, ForwardCursor & cur2) const
         {
@@ -918,6 +3430,132 @@ inline namespace v1
         }
     };
 
+    /// @cond false
+    namespace details
+    {
+        template <class InputCursor, class OutputCursor, class BinaryPredicate,
+                  bool = ::sayan::is_contiguous_cursor<InputCursor>::value
+                         && ::sayan::is_contiguous_cursor<OutputCursor>::value>
+        struct is_simd_unique_copy_compatible
+         : std::false_type
+        {};
+
+        template <class InputCursor, class OutputCursor, class BinaryPredicate>
+        struct is_simd_unique_copy_compatible<InputCursor, OutputCursor, BinaryPredicate, true>
+         : std::integral_constant<bool, std::is_same<std::remove_cv_t<std::remove_pointer_t<::sayan::contiguous_pointer_t<InputCursor>>>,
+                                                     std::remove_pointer_t<::sayan::contiguous_pointer_t<OutputCursor>>>::value
+                                        && !std::is_const<std::remove_pointer_t<::sayan::contiguous_pointer_t<OutputCursor>>>::value
+                                        && is_simd_find_compatible<std::remove_pointer_t<::sayan::contiguous_pointer_t<OutputCursor>>,
+                                                                   std::remove_pointer_t<::sayan::contiguous_pointer_t<OutputCursor>>,
+                                                                   BinaryPredicate>::value>
+        {};
+
+        /* Копирует первый элемент каждой группы равных соседних элементов.
+        Каждый элемент сравнивается с предыдущим элементом входа: для
+        std::equal_to<> и арифметических типов это равносильно сравнению с
+        последним записанным значением. Выход может совпадать со входом или
+        начинаться раньше него. Возвращает количество прочитанных и записанных
+        элементов; чтение прекращается после элемента, заполнившего выход.
+        */
+        template <class T1, class T2>
+        std::pair<std::ptrdiff_t, std::ptrdiff_t>
+        unique_copy_blocks(T1 * in, std::ptrdiff_t n, T2 * out, std::ptrdiff_t capacity)
+        {
+            if(n == 0 || capacity == 0)
+            {
+                return {0, 0};
+            }
+
+            out[0] = in[0];
+
+            std::ptrdiff_t i = 1;
+            std::ptrdiff_t j = 1;
+
+#if defined(__SSE2__)
+            // Два блока по 16 байт за итерацию
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(32 / sizeof(T2));
+
+            // Биты маски movemask, соответствующие первым байтам элементов
+            constexpr std::uint32_t lane_bits = sizeof(T2) == 1 ? 0xFFFFFFFF
+                                              : sizeof(T2) == 2 ? 0x55555555
+                                              : sizeof(T2) == 4 ? 0x11111111 : 0x01010101;
+
+            auto const equal_lanes = [](T1 * p)
+            {
+                auto const load = [](T1 * q)
+                {
+                    return _mm_loadu_si128(reinterpret_cast<__m128i const *>(q));
+                };
+
+                auto const eq = details::simd_equal_lanes<T2>(load(p), load(p - 1));
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(eq));
+            };
+
+            for(; n - i >= lanes && capacity - j >= lanes; i += lanes)
+            {
+                auto const equal = equal_lanes(in + i) | (equal_lanes(in + i + lanes / 2) << 16);
+                auto const fresh = ~equal & lane_bits;
+
+                if(fresh == lane_bits)
+                {
+                    if(static_cast<void const *>(out + j) != static_cast<void const *>(in + i))
+                    {
+                        std::memmove(out + j, in + i, sizeof(T2) * lanes);
+                    }
+
+                    j += lanes;
+                }
+                else if(fresh != 0)
+                {
+                    /* Каждый элемент записывается безусловно, а позиция записи
+                    сдвигается только для новых значений. Последняя запись
+                    может попасть за конец результата, поэтому прежнее
+                    значение этой позиции восстанавливается.
+                    */
+                    T2 saved[lanes];
+                    std::memcpy(saved, out + j, sizeof(saved));
+
+                    auto const start = j;
+
+                    for(std::ptrdiff_t lane = 0; lane != lanes; ++ lane)
+                    {
+                        out[j] = in[i + lane];
+                        j += (fresh >> (lane * sizeof(T2))) & 1u;
+                    }
+
+                    out[j] = saved[j - start];
+                }
+            }
+#endif
+
+            auto prev = in[i - 1];
+
+            for(; i != n && j != capacity; ++ i)
+            {
+                auto const x = in[i];
+
+                if(!(x == prev))
+                {
+                    out[j] = x;
+                    ++ j;
+                }
+
+                prev = x;
+            }
+
+            return {i, j};
+        }
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Копирование без повторяющихся соседних элементов
+    @details Если вход и выход -- непрерывные последовательности арифметических
+    значений одного типа, а предикат -- std::equal_to<>, соседние элементы
+    сравниваются блоками по 32 байта с помощью SSE2; блоки без повторов
+    копируются целиком, блоки из одних повторов пропускаются, а в остальных
+    новые значения выбираются без ветвлений.
+    */
     struct unique_copy_fn
     {
     public:
@@ -931,6 +3569,18 @@ inline namespace v1
             auto in_cur = ::sayan::cursor_fwd<InputSequence>(in);
             auto out_cur = ::sayan::cursor_fwd<OutputSequence>(out);
 
+            using Tag = details::is_simd_unique_copy_compatible<decltype(in_cur), decltype(out_cur),
+                                                                BinaryPredicate>;
+
+            return this->impl(std::move(in_cur), std::move(out_cur), bin_pred, Tag{});
+        }
+
+    private:
+        template <class InputCursor, class OutputCursor, class BinaryPredicate>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, BinaryPredicate & bin_pred,
+             std::false_type) const
+        {
             if(!in_cur || !out_cur)
             {
                 return {std::move(in_cur), std::move(out_cur)};
@@ -951,22 +3601,62 @@ inline namespace v1
 
             return {std::move(in_cur), std::move(out_cur)};
         }
+
+        template <class InputCursor, class OutputCursor, class BinaryPredicate>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, BinaryPredicate & bin_pred,
+             std::true_type) const
+        {
+            auto const in = ::sayan::cursor_data(in_cur);
+            auto const out = ::sayan::cursor_data(out_cur);
+
+            if(reinterpret_cast<std::uintptr_t>(out) > reinterpret_cast<std::uintptr_t>(in)
+               && details::memory_overlaps(in, in + in_cur.size(), out, out + out_cur.size()))
+            {
+                return this->impl(std::move(in_cur), std::move(out_cur), bin_pred, std::false_type{});
+            }
+
+            auto const r = details::unique_copy_blocks(in, in_cur.size(), out, out_cur.size());
+
+            in_cur += r.first;
+            out_cur += r.second;
+
+            return {std::move(in_cur), std::move(out_cur)};
+        }
     };
 
+    /** @brief Удаление повторяющихся соседних элементов
+    @details Для непрерывных последовательностей арифметических значений и
+    std::equal_to<> используется блочное сравнение соседних элементов, как в
+    unique_copy.
+    */
     struct unique_fn
     {
+    public:
         template <class ForwardSequence, class BinaryPredicate = std::equal_to<>>
         safe_cursor_type_t<ForwardSequence>
         operator()(ForwardSequence && seq, BinaryPredicate bin_pred = BinaryPredicate{}) const
         {
-            auto out = adjacent_find_fn{}(std::forward<ForwardSequence>(seq), bin_pred);
+            auto cur = ::sayan::cursor_fwd<ForwardSequence>(seq);
+
+            using Tag = details::is_simd_unique_copy_compatible<decltype(cur), decltype(cur),
+                                                                BinaryPredicate>;
+
+            return this->impl(std::move(cur), bin_pred, Tag{});
+        }
+
+    private:
+        template <class ForwardCursor, class BinaryPredicate>
+        ForwardCursor impl(ForwardCursor cur, BinaryPredicate & bin_pred, std::false_type) const
+        {
+            auto out = adjacent_find_fn{}(std::move(cur), bin_pred);
 
             if(!out)
             {
                 return out;
             }
 
-            auto cur = out;
+            cur = out;
             ++ cur;
             assert(!!out);
             ++ cur;
@@ -976,13 +3666,23 @@ inline namespace v1
                 if(!bin_pred(*out, *cur))
                 {
                     ++ out;
-                    *out = std::move(*cur);
+                    *out = ::sayan::cursor_move(cur);
                 }
             }
 
             ++ out;
             return out;
         }
+
+        template <class ForwardCursor, class BinaryPredicate>
+        ForwardCursor impl(ForwardCursor cur, BinaryPredicate &, std::true_type) const
+        {
+            auto const first = ::sayan::cursor_data(cur);
+            auto const n = cur.size();
+
+            cur += details::unique_copy_blocks(first, n, first, n).second;
+            return cur;
+        }
     };
 
     struct partition_copy_fn
@@ -1129,6 +3829,37 @@ inline namespace v1
         }
     };
 
+    /// @cond false
+    namespace details
+    {
+        /* Предикат с переставленными аргументами. Для стандартных сравнений
+        возвращается обратное стандартное сравнение, для которого возможна
+        векторизация.
+        */
+        template <class Compare>
+        auto swap_arguments(Compare & cmp)
+        {
+            return [&cmp](auto && x, auto && y) { return cmp(y, x); };
+        }
+
+        inline std::greater<> swap_arguments(std::less<> &)
+        {
+            return {};
+        }
+
+        inline std::less<> swap_arguments(std::greater<> &)
+        {
+            return {};
+        }
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Поиск конца упорядоченного начала последовательности
+    @details Для std::less<> и std::greater<> поиск нарушения порядка
+    выполняет adjacent_find с обратным стандартным сравнением, поэтому для
+    непрерывных последовательностей арифметических значений он векторизуется.
+    */
     struct is_sorted_until_fn
     {
         template <class ForwardSequence, class Compare = std::less<>>
@@ -1136,10 +3867,8 @@ inline namespace v1
         operator()(ForwardSequence && seq, Compare cmp = Compare{}) const
         {
             auto cur = ::sayan::cursor_fwd<ForwardSequence>(seq);
-            using Ref = decltype(*cur);
 
-            cur = ::sayan::adjacent_find_fn{}(std::move(cur),
-                                              [&cmp](Ref x, Ref y) { return cmp(y, x); });
+            cur = ::sayan::adjacent_find_fn{}(std::move(cur), details::swap_arguments(cmp));
 
             if(!!cur)
             {
@@ -1755,8 +4484,328 @@ inline namespace v1
         }
     };
 
+    /// @cond false
+    namespace details
+    {
+        /* Поиск наименьшего и наибольшего элементов в последовательности
+        арифметических значений с помощью std::less<> выполняется поблочно:
+        в каждом элементе блока хранится лучшее значение и номер блока, в
+        котором оно найдено. Номер блока хранится в целом того же размера, что
+        и элементы, поэтому последовательность обрабатывается частями не более
+        чем из numeric_limits<Counter>::max() блоков.
+        */
+        template <class T, class Compare>
+        struct is_simd_minmax_compatible
+#if defined(__SSE2__)
+         : std::integral_constant<bool, std::is_same<Compare, std::less<>>::value
+                                        && std::is_arithmetic<T>::value
+                                        && !std::is_same<std::remove_cv_t<T>, bool>::value
+                                        && !std::is_volatile<T>::value
+                                        && is_simd_block_compatible<T>::value
+                                        && (std::is_floating_point<T>::value || sizeof(T) <= 4)>
+#else
+         : std::false_type
+#endif
+        {};
+
+#if defined(__SSE2__)
+        // Маска элементов, равных NaN, то есть не упорядоченных относительно других
+        template <std::size_t Size, class Kind>
+        __m128i simd_unordered_lanes(__m128i, std::integral_constant<std::size_t, Size>, Kind)
+        {
+            return _mm_setzero_si128();
+        }
+
+        inline __m128i simd_unordered_lanes(__m128i x, std::integral_constant<std::size_t, 4>,
+                                            simd_floating_tag)
+        {
+            auto const y = _mm_castsi128_ps(x);
+            return _mm_castps_si128(_mm_cmpunord_ps(y, y));
+        }
+
+        inline __m128i simd_unordered_lanes(__m128i x, std::integral_constant<std::size_t, 8>,
+                                            simd_floating_tag)
+        {
+            auto const y = _mm_castsi128_pd(x);
+            return _mm_castpd_si128(_mm_cmpunord_pd(y, y));
+        }
+
+        template <class T>
+        __m128i simd_unordered_lanes(__m128i x)
+        {
+            return details::simd_unordered_lanes(x, std::integral_constant<std::size_t, sizeof(T)>{},
+                                                 simd_number_kind_t<T>{});
+        }
+
+        /* Первый из наименьших элементов. При равенстве значений предпочтение
+        отдаётся меньшему номеру, поэтому кандидаты из разных элементов блока
+        можно объединять в любом порядке.
+        */
+        template <class T>
+        class simd_min_tracker
+        {
+        public:
+            explicit simd_min_tracker(T const & first_value)
+             : value_(first_value)
+             , index_(0)
+            {}
+
+            void start(__m128i x)
+            {
+                this->best_ = x;
+                this->best_block_ = _mm_setzero_si128();
+            }
+
+            void update(__m128i x, __m128i block_no)
+            {
+                auto const better = details::simd_less_lanes<T>(x, this->best_);
+
+                this->best_ = details::simd_select(better, x, this->best_);
+                this->best_block_ = details::simd_select(better, block_no, this->best_block_);
+            }
+
+            template <class Lane>
+            void finish(std::ptrdiff_t offset)
+            {
+                constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(T));
+
+                alignas(16) T values[lanes];
+                alignas(16) Lane blocks[lanes];
+                _mm_store_si128(reinterpret_cast<__m128i *>(values), this->best_);
+                _mm_store_si128(reinterpret_cast<__m128i *>(blocks), this->best_block_);
+
+                for(std::ptrdiff_t i = 0; i != lanes; ++ i)
+                {
+                    this->merge(values[i], offset + static_cast<std::ptrdiff_t>(blocks[i]) * lanes + i);
+                }
+            }
+
+            void merge(T const & value, std::ptrdiff_t index)
+            {
+                if(value < this->value_ || (!(this->value_ < value) && index < this->index_))
+                {
+                    this->value_ = value;
+                    this->index_ = index;
+                }
+            }
+
+            std::ptrdiff_t index() const
+            {
+                return this->index_;
+            }
+
+        private:
+            __m128i best_;
+            __m128i best_block_;
+            T value_;
+            std::ptrdiff_t index_;
+        };
+
+        // Последний из наибольших элементов
+        template <class T>
+        class simd_max_tracker
+        {
+        public:
+            explicit simd_max_tracker(T const & first_value)
+             : value_(first_value)
+             , index_(0)
+            {}
+
+            void start(__m128i x)
+            {
+                this->best_ = x;
+                this->best_block_ = _mm_setzero_si128();
+            }
+
+            void update(__m128i x, __m128i block_no)
+            {
+                auto const worse = details::simd_less_lanes<T>(x, this->best_);
+
+                this->best_ = details::simd_select(worse, this->best_, x);
+                this->best_block_ = details::simd_select(worse, this->best_block_, block_no);
+            }
+
+            template <class Lane>
+            void finish(std::ptrdiff_t offset)
+            {
+                constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(T));
+
+                alignas(16) T values[lanes];
+                alignas(16) Lane blocks[lanes];
+                _mm_store_si128(reinterpret_cast<__m128i *>(values), this->best_);
+                _mm_store_si128(reinterpret_cast<__m128i *>(blocks), this->best_block_);
+
+                for(std::ptrdiff_t i = 0; i != lanes; ++ i)
+                {
+                    this->merge(values[i], offset + static_cast<std::ptrdiff_t>(blocks[i]) * lanes + i);
+                }
+            }
+
+            void merge(T const & value, std::ptrdiff_t index)
+            {
+                if(this->value_ < value || (!(value < this->value_) && this->index_ < index))
+                {
+                    this->value_ = value;
+                    this->index_ = index;
+                }
+            }
+
+            std::ptrdiff_t index() const
+            {
+                return this->index_;
+            }
+
+        private:
+            __m128i best_;
+            __m128i best_block_;
+            T value_;
+            std::ptrdiff_t index_;
+        };
+
+        template <class T>
+        class simd_minmax_tracker
+        {
+        public:
+            explicit simd_minmax_tracker(T const & first_value)
+             : min_(first_value)
+             , max_(first_value)
+            {}
+
+            void start(__m128i x)
+            {
+                this->min_.start(x);
+                this->max_.start(x);
+            }
+
+            void update(__m128i x, __m128i block_no)
+            {
+                this->min_.update(x, block_no);
+                this->max_.update(x, block_no);
+            }
+
+            template <class Lane>
+            void finish(std::ptrdiff_t offset)
+            {
+                this->min_.template finish<Lane>(offset);
+                this->max_.template finish<Lane>(offset);
+            }
+
+            void merge(T const & value, std::ptrdiff_t index)
+            {
+                this->min_.merge(value, index);
+                this->max_.merge(value, index);
+            }
+
+            std::ptrdiff_t min_index() const
+            {
+                return this->min_.index();
+            }
+
+            std::ptrdiff_t max_index() const
+            {
+                return this->max_.index();
+            }
+
+        private:
+            simd_min_tracker<T> min_;
+            simd_max_tracker<T> max_;
+        };
+
+        /* Возвращает false, если в последовательности встретился NaN: в этом
+        случае результат последовательного алгоритма зависит от порядка
+        сравнений, и его нужно вычислять без векторизации. Номера элементов
+        отсчитываются от offset.
+        */
+        template <class T, class Tracker>
+        bool minmax_lanes(T * first, T * last, Tracker & tracker, std::ptrdiff_t offset = 0)
+        {
+            using Element = std::remove_cv_t<T>;
+            using Counter = simd_counter<sizeof(T)>;
+            using Lane = typename Counter::type;
+
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(T));
+            constexpr auto max_blocks = std::numeric_limits<Lane>::max();
+
+            auto const load = [](T * p)
+            {
+                return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+            };
+
+            auto const base = first;
+            auto const minus_one = _mm_set1_epi32(-1);
+            auto unordered = _mm_setzero_si128();
+
+            while(last - first >= lanes)
+            {
+                auto const n_blocks
+                    = std::min<std::uintmax_t>(static_cast<std::uintmax_t>((last - first) / lanes),
+                                               max_blocks);
+
+                auto x = load(first);
+                unordered = _mm_or_si128(unordered, details::simd_unordered_lanes<Element>(x));
+                tracker.start(x);
+
+                auto block_no = _mm_setzero_si128();
+
+                for(std::uintmax_t i = 1; i != n_blocks; ++ i)
+                {
+                    block_no = Counter::subtract(block_no, minus_one);
+
+                    x = load(first + static_cast<std::ptrdiff_t>(i) * lanes);
+                    unordered = _mm_or_si128(unordered, details::simd_unordered_lanes<Element>(x));
+                    tracker.update(x, block_no);
+                }
+
+                tracker.template finish<Lane>(offset + (first - base));
+                first += static_cast<std::ptrdiff_t>(n_blocks) * lanes;
+            }
+
+            auto ordered = (_mm_movemask_epi8(unordered) == 0);
+
+            for(; first != last; ++ first)
+            {
+                Element const x = *first;
+                ordered = ordered && !(x != x);
+                tracker.merge(x, offset + (first - base));
+            }
+
+            return ordered;
+        }
+
+        /* Элементы курсора с постоянным шагом копируются в локальный буфер
+        блоками, которые обрабатываются так же, как непрерывные
+        последовательности
+        */
+        template <class StridedCursor, class Tracker>
+        bool strided_minmax_lanes(StridedCursor const & cur, Tracker & tracker)
+        {
+            using Gather = strided_gather<std::remove_pointer_t<decltype(cur.data())>>;
+
+            Gather gather(cur.data(), cur.stride());
+
+            auto const n = cur.size();
+
+            for(std::ptrdiff_t offset = 0; offset < n; offset += Gather::block_size)
+            {
+                auto const m = std::min(n - offset, Gather::block_size);
+                auto const first = gather.block(offset, m);
+
+                if(!details::minmax_lanes(first, first + m, tracker, offset))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+#endif
+    }
+    // namespace details
+    /// @endcond
+
     struct min_element_fn
     {
+    public:
         template <class ForwardSequence, class Compare = std::less<>>
         safe_cursor_type_t<ForwardSequence>
         operator()(ForwardSequence && seq, Compare cmp = Compare{}) const
@@ -1768,6 +4817,13 @@ inline namespace v1
                 return result;
             }
 
+            return this->impl(std::move(result), cmp, cursor_layout_t<decltype(result)>{});
+        }
+
+    private:
+        template <class ForwardCursor, class Compare>
+        ForwardCursor impl(ForwardCursor result, Compare & cmp, generic_layout_tag) const
+        {
             auto cur = result;
             ++ cur;
 
@@ -1781,10 +4837,88 @@ inline namespace v1
 
             return result;
         }
+
+        template <class ContiguousCursor, class Compare>
+        ContiguousCursor impl(ContiguousCursor result, Compare & cmp, contiguous_layout_tag) const
+        {
+            using Value = std::remove_pointer_t<decltype(::sayan::cursor_data(result))>;
+
+            return this->impl_contiguous(std::move(result), cmp,
+                                         details::is_simd_minmax_compatible<Value, Compare>{});
+        }
+
+        template <class ContiguousCursor, class Compare>
+        ContiguousCursor impl_contiguous(ContiguousCursor result, Compare & cmp,
+                                         std::false_type) const
+        {
+            return this->impl(std::move(result), cmp, generic_layout_tag{});
+        }
+
+#if defined(__SSE2__)
+        /* Возвращает тот же курсор, что и последовательный алгоритм, то есть
+        первый из наименьших элементов. Если последовательность содержит NaN,
+        результат последовательного алгоритма зависит от положения NaN
+        (например, NaN в начале последовательности не сравним ни с одним
+        элементом и остаётся результатом поиска наименьшего), поэтому в этом
+        случае поиск повторяется без векторизации.
+        */
+        template <class ContiguousCursor, class Compare>
+        ContiguousCursor impl_contiguous(ContiguousCursor result, Compare & cmp,
+                                         std::true_type) const
+        {
+            auto const first = ::sayan::cursor_data(result);
+            auto const last = first + result.size();
+
+            details::simd_min_tracker<std::remove_cv_t<std::remove_pointer_t<decltype(first)>>>
+                tracker(*first);
+
+            if(!details::minmax_lanes(first, last, tracker))
+            {
+                return this->impl(std::move(result), cmp, generic_layout_tag{});
+            }
+
+            result += tracker.index();
+            return result;
+        }
+#endif
+
+        template <class StridedCursor, class Compare>
+        StridedCursor impl(StridedCursor result, Compare & cmp, strided_layout_tag) const
+        {
+            using Value = std::remove_pointer_t<decltype(result.data())>;
+
+            return this->impl_strided(std::move(result), cmp,
+                                      details::is_simd_minmax_compatible<Value, Compare>{});
+        }
+
+        template <class StridedCursor, class Compare>
+        StridedCursor impl_strided(StridedCursor result, Compare & cmp, std::false_type) const
+        {
+            return this->impl(std::move(result), cmp, generic_layout_tag{});
+        }
+
+#if defined(__SSE2__)
+        template <class StridedCursor, class Compare>
+        StridedCursor impl_strided(StridedCursor result, Compare & cmp, std::true_type) const
+        {
+            using Value = std::remove_cv_t<std::remove_pointer_t<decltype(result.data())>>;
+
+            details::simd_min_tracker<Value> tracker(*result);
+
+            if(!details::strided_minmax_lanes(result, tracker))
+            {
+                return this->impl(std::move(result), cmp, generic_layout_tag{});
+            }
+
+            result += tracker.index();
+            return result;
+        }
+#endif
     };
 
     struct max_element_fn
     {
+    public:
         template <class ForwardSequence, class Compare = std::less<>>
         safe_cursor_type_t<ForwardSequence>
         operator()(ForwardSequence && seq, Compare cmp = Compare{}) const
@@ -1796,6 +4930,13 @@ inline namespace v1
                 return result;
             }
 
+            return this->impl(std::move(result), cmp, cursor_layout_t<decltype(result)>{});
+        }
+
+    private:
+        template <class ForwardCursor, class Compare>
+        ForwardCursor impl(ForwardCursor result, Compare & cmp, generic_layout_tag) const
+        {
             auto cur = result;
             ++ cur;
 
@@ -1809,17 +4950,207 @@ inline namespace v1
 
             return result;
         }
+
+        template <class ContiguousCursor, class Compare>
+        ContiguousCursor impl(ContiguousCursor result, Compare & cmp, contiguous_layout_tag) const
+        {
+            using Value = std::remove_pointer_t<decltype(::sayan::cursor_data(result))>;
+
+            return this->impl_contiguous(std::move(result), cmp,
+                                         details::is_simd_minmax_compatible<Value, Compare>{});
+        }
+
+        template <class ContiguousCursor, class Compare>
+        ContiguousCursor impl_contiguous(ContiguousCursor result, Compare & cmp,
+                                         std::false_type) const
+        {
+            return this->impl(std::move(result), cmp, generic_layout_tag{});
+        }
+
+#if defined(__SSE2__)
+        /* Возвращает тот же курсор, что и последовательный алгоритм, то есть
+        последний из наибольших элементов. Если последовательность содержит NaN,
+        результат последовательного алгоритма зависит от положения NaN
+        (например, NaN и элемент, следующий за ним, всегда становятся текущим
+        наибольшим, так как ни один из них не меньше предыдущего), поэтому в этом
+        случае поиск повторяется без векторизации.
+        */
+        template <class ContiguousCursor, class Compare>
+        ContiguousCursor impl_contiguous(ContiguousCursor result, Compare & cmp,
+                                         std::true_type) const
+        {
+            auto const first = ::sayan::cursor_data(result);
+            auto const last = first + result.size();
+
+            details::simd_max_tracker<std::remove_cv_t<std::remove_pointer_t<decltype(first)>>>
+                tracker(*first);
+
+            if(!details::minmax_lanes(first, last, tracker))
+            {
+                return this->impl(std::move(result), cmp, generic_layout_tag{});
+            }
+
+            result += tracker.index();
+            return result;
+        }
+#endif
+
+        template <class StridedCursor, class Compare>
+        StridedCursor impl(StridedCursor result, Compare & cmp, strided_layout_tag) const
+        {
+            using Value = std::remove_pointer_t<decltype(result.data())>;
+
+            return this->impl_strided(std::move(result), cmp,
+                                      details::is_simd_minmax_compatible<Value, Compare>{});
+        }
+
+        template <class StridedCursor, class Compare>
+        StridedCursor impl_strided(StridedCursor result, Compare & cmp, std::false_type) const
+        {
+            return this->impl(std::move(result), cmp, generic_layout_tag{});
+        }
+
+#if defined(__SSE2__)
+        template <class StridedCursor, class Compare>
+        StridedCursor impl_strided(StridedCursor result, Compare & cmp, std::true_type) const
+        {
+            using Value = std::remove_cv_t<std::remove_pointer_t<decltype(result.data())>>;
+
+            details::simd_max_tracker<Value> tracker(*result);
+
+            if(!details::strided_minmax_lanes(result, tracker))
+            {
+                return this->impl(std::move(result), cmp, generic_layout_tag{});
+            }
+
+            result += tracker.index();
+            return result;
+        }
+#endif
     };
 
     struct minmax_element_fn
     {
+    public:
         template <class ForwardSequence, class Compare = std::less<>>
         std::pair<safe_cursor_type_t<ForwardSequence>, safe_cursor_type_t<ForwardSequence>>
         operator()(ForwardSequence && seq, Compare cmp = Compare{}) const
         {
             auto cur = ::sayan::cursor_fwd<ForwardSequence>(seq);
-            return {sayan::min_element_fn{}(cur, cmp), sayan::max_element_fn{}(cur, cmp)};
+
+            if(!cur)
+            {
+                return {cur, cur};
+            }
+
+            return this->impl(std::move(cur), cmp, cursor_layout_t<decltype(cur)>{});
+        }
+
+    private:
+        /* Элементы сравниваются попарно: меньший из пары -- с текущим
+        наименьшим, больший -- с текущим наибольшим, что требует около 3n/2
+        сравнений за один проход. Как и std::minmax_element, возвращает
+        первый из наименьших и последний из наибольших элементов.
+        */
+        template <class ForwardCursor, class Compare>
+        std::pair<ForwardCursor, ForwardCursor>
+        impl(ForwardCursor cur, Compare & cmp, generic_layout_tag) const
+        {
+            auto min = cur;
+            auto max = cur;
+            ++ cur;
+
+            while(!!cur)
+            {
+                auto first = cur;
+                ++ cur;
+
+                if(!cur)
+                {
+                    if(cmp(*first, *min))
+                    {
+                        min = first;
+                    }
+                    else if(!cmp(*first, *max))
+                    {
+                        max = first;
+                    }
+
+                    break;
+                }
+
+                if(cmp(*cur, *first))
+                {
+                    if(cmp(*cur, *min))
+                    {
+                        min = cur;
+                    }
+
+                    if(!cmp(*first, *max))
+                    {
+                        max = first;
+                    }
+                }
+                else
+                {
+                    if(cmp(*first, *min))
+                    {
+                        min = first;
+                    }
+
+                    if(!cmp(*cur, *max))
+                    {
+                        max = cur;
+                    }
+                }
+
+                ++ cur;
+            }
+
+            return {std::move(min), std::move(max)};
+        }
+
+        template <class ContiguousCursor, class Compare>
+        std::pair<ContiguousCursor, ContiguousCursor>
+        impl(ContiguousCursor cur, Compare & cmp, contiguous_layout_tag) const
+        {
+            using Value = std::remove_pointer_t<decltype(::sayan::cursor_data(cur))>;
+
+            return this->impl_contiguous(std::move(cur), cmp,
+                                         details::is_simd_minmax_compatible<Value, Compare>{});
+        }
+
+        template <class ContiguousCursor, class Compare>
+        std::pair<ContiguousCursor, ContiguousCursor>
+        impl_contiguous(ContiguousCursor cur, Compare & cmp, std::false_type) const
+        {
+            return this->impl(std::move(cur), cmp, generic_layout_tag{});
+        }
+
+#if defined(__SSE2__)
+        template <class ContiguousCursor, class Compare>
+        std::pair<ContiguousCursor, ContiguousCursor>
+        impl_contiguous(ContiguousCursor cur, Compare & cmp, std::true_type) const
+        {
+            auto const first = ::sayan::cursor_data(cur);
+            auto const last = first + cur.size();
+
+            details::simd_minmax_tracker<std::remove_cv_t<std::remove_pointer_t<decltype(first)>>>
+                tracker(*first);
+
+            if(!details::minmax_lanes(first, last, tracker))
+            {
+                return this->impl(std::move(cur), cmp, generic_layout_tag{});
+            }
+
+            auto min = cur;
+            min += tracker.min_index();
+
+            cur += tracker.max_index();
+
+            return {std::move(min), std::move(cur)};
         }
+#endif
     };
 
     struct is_permutation_fn
@@ -1911,6 +5242,7 @@ inline namespace v1
         constexpr auto const & equal = static_const<equal_fn>;
 
         constexpr auto const & find = static_const<find_fn>;
+        constexpr auto const & find_with_sentinel = static_const<find_with_sentinel_fn>;
         constexpr auto const & find_if = static_const<find_if_fn>;
         constexpr auto const & find_if_not = static_const<find_if_not_fn>;
 
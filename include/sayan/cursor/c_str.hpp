@@ -0,0 +1,131 @@
+#ifndef Z_SAYAN_CURSOR_C_STR_HPP_INCLUDED
+#define Z_SAYAN_CURSOR_C_STR_HPP_INCLUDED
+
+/** @file sayan/cursor/c_str.hpp
+ @brief Курсор строк, завершающихся нулевым символом
+ @details Исчерпание курсора определяется по значению текущего элемента, поэтому
+ конец строки не нужно вычислять заранее.
+*/
+
+#include <sayan/cursor/defs.hpp>
+#include <sayan/cursor/check_policies.hpp>
+#include <sayan/utility/static_const.hpp>
+#include <sayan/utility/with_old_value.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace sayan
+{
+inline namespace v1
+{
+    /** @brief Курсор строки, завершающейся нулевым символом
+    @tparam Char тип символов (возможно, константный)
+    @tparam Check стратегия проверок
+    */
+    template <class Char, class Check = cursor_checking_throw>
+    class c_str_cursor_type
+    {
+        friend c_str_cursor_type cursor_hook(c_str_cursor_type cur, adl_tag)
+        {
+            cur.forget(::sayan::front_fn{});
+
+            return cur;
+        }
+
+    public:
+        // Типы
+        using value_type = std::remove_const_t<Char>;
+        using reference = Char &;
+        using difference_type = std::ptrdiff_t;
+
+        // Создание
+        /** @brief Конструктор
+        @param str указатель на строку, завершающуюся нулевым символом
+        @pre @c str не является нулевым указателем
+        @post <tt> this->begin() == str </tt>
+        */
+        explicit c_str_cursor_type(Char * str)
+         : begin_(str)
+        {}
+
+        // Однопроходный курсор
+        /** @brief Проверка исчерпания
+        @return <tt> *this->begin() == value_type{} </tt>
+        */
+        bool empty() const
+        {
+            return *this->begin_.value() == value_type{};
+        }
+
+        reference operator[](::sayan::front_fn) const
+        {
+            Check::ensure_not_empty(*this);
+
+            return *this->begin_.value();
+        }
+
+        void drop(::sayan::front_fn)
+        {
+            Check::ensure_not_empty(*this);
+
+            ++ this->begin_.value();
+        }
+
+        // Прямой курсор
+        void forget(::sayan::front_fn)
+        {
+            this->begin_.commit();
+        }
+
+        void exhaust(::sayan::front_fn)
+        {
+            for(; !this->empty(); ++ this->begin_.value())
+            {}
+        }
+
+        // Итераторы
+        Char * begin() const
+        {
+            return this->begin_.value();
+        }
+
+        Char * traversed_begin() const
+        {
+            return this->begin_.old_value();
+        }
+
+    private:
+        ::sayan::with_old_value<Char *> begin_;
+    };
+
+    /// @cond false
+    namespace details
+    {
+        struct c_str_cursor_fn
+        {
+            template <class Char>
+            ::sayan::c_str_cursor_type<Char>
+            operator()(Char * str) const
+            {
+                return ::sayan::c_str_cursor_type<Char>(str);
+            }
+        };
+    }
+    // namespace details
+    /// @endcond
+
+    namespace
+    {
+        /** @brief Функциональный объект для создания курсора строки,
+        завершающейся нулевым символом
+        */
+        constexpr auto const & c_str_cursor = static_const<details::c_str_cursor_fn>;
+    }
+}
+// namespace v1
+}
+// namespace sayan
+
+#endif
+// Z_SAYAN_CURSOR_C_STR_HPP_INCLUDED
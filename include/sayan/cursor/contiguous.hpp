@@ -0,0 +1,190 @@
+#ifndef Z_SAYAN_CURSOR_CONTIGUOUS_HPP_INCLUDED
+#define Z_SAYAN_CURSOR_CONTIGUOUS_HPP_INCLUDED
+
+/** @file sayan/cursor/contiguous.hpp
+ @brief Курсоры последовательностей, элементы которых расположены в памяти
+ непрерывно, и преобразование таких курсоров к курсорам на основе указателей.
+*/
+
+#include <sayan/cursor/iterator_cursor.hpp>
+#include <sayan/utility/static_const.hpp>
+
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace sayan
+{
+inline namespace v1
+{
+    /// @cond false
+    namespace details
+    {
+        template <class Value>
+        struct is_vector_value
+         : std::integral_constant<bool, std::is_object<Value>::value
+                                        && !std::is_array<Value>::value
+                                        && !std::is_const<Value>::value
+                                        && !std::is_same<Value, bool>::value>
+        {};
+
+        template <class Iterator, class Value, bool = is_vector_value<Value>::value>
+        struct is_vector_iterator
+         : std::false_type
+        {};
+
+        template <class Iterator, class Value>
+        struct is_vector_iterator<Iterator, Value, true>
+         : std::integral_constant<bool, std::is_same<Iterator, typename std::vector<Value>::iterator>::value
+                                        || std::is_same<Iterator, typename std::vector<Value>::const_iterator>::value>
+        {};
+
+        template <class Value>
+        struct is_char_value
+         : std::integral_constant<bool, std::is_same<Value, char>::value
+                                        || std::is_same<Value, wchar_t>::value
+                                        || std::is_same<Value, char16_t>::value
+                                        || std::is_same<Value, char32_t>::value>
+        {};
+
+        template <class Iterator, class Value, bool = is_char_value<Value>::value>
+        struct is_string_iterator
+         : std::false_type
+        {};
+
+        template <class Iterator, class Value>
+        struct is_string_iterator<Iterator, Value, true>
+         : std::integral_constant<bool, std::is_same<Iterator, typename std::basic_string<Value>::iterator>::value
+                                        || std::is_same<Iterator, typename std::basic_string<Value>::const_iterator>::value>
+        {};
+
+        template <class Iterator, bool = std::is_pointer<Iterator>::value>
+        struct is_contiguous_iterator
+         : std::true_type
+        {};
+
+        template <class Iterator>
+        struct is_contiguous_iterator<Iterator, false>
+         : std::integral_constant<bool, is_vector_iterator<Iterator, typename std::iterator_traits<Iterator>::value_type>::value
+                                        || is_string_iterator<Iterator, typename std::iterator_traits<Iterator>::value_type>::value>
+        {};
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Проверка того, что итератор указывает на элементы, расположенные
+    в памяти непрерывно.
+    @details Истинно для указателей, а также итераторов @c std::vector (кроме
+    @c std::vector<bool>) и @c std::basic_string. Для других итераторов с
+    непрерывным размещением элементов данный шаблон можно специализировать.
+    */
+    template <class Iterator>
+    struct is_contiguous_iterator
+     : details::is_contiguous_iterator<Iterator>::type
+    {};
+
+    /** @brief Проверка того, что курсор проходит последовательность,
+    элементы которой расположены в памяти непрерывно.
+    @details Такие курсоры могут быть преобразованы в курсоры на основе
+    указателей, что позволяет алгоритмам использовать низкоуровневые функции
+    (@c memchr, @c memmove и т.д.) и векторные инструкции процессора.
+    */
+    template <class Cursor>
+    struct is_contiguous_cursor
+     : std::false_type
+    {};
+
+    template <class Iterator, class Check>
+    struct is_contiguous_cursor<iterator_cursor_type<Iterator, Iterator, Check>>
+     : is_contiguous_iterator<Iterator>
+    {};
+
+    template <class Cursor>
+    struct is_contiguous_cursor<Cursor const>
+     : is_contiguous_cursor<Cursor>
+    {};
+
+    /// @brief Тип указателя на элементы курсора с непрерывным размещением
+    template <class ContiguousCursor>
+    using contiguous_pointer_t
+        = std::add_pointer_t<std::remove_reference_t<typename ContiguousCursor::reference>>;
+
+    /// @brief Тип курсора, проходящего интервал, заданный парой указателей
+    template <class T, class Check = cursor_checking_throw>
+    using pointer_cursor_type = iterator_cursor_type<T *, T *, Check>;
+
+    /// @cond false
+    namespace details
+    {
+        template <class T>
+        T * iterator_to_address(T * p)
+        {
+            return p;
+        }
+
+        template <class Iterator>
+        auto iterator_to_address(Iterator const & i)
+        {
+            return std::addressof(*i);
+        }
+
+        struct cursor_data_fn
+        {
+            template <class ContiguousCursor>
+            contiguous_pointer_t<ContiguousCursor>
+            operator()(ContiguousCursor const & cur) const
+            {
+                static_assert(::sayan::is_contiguous_cursor<ContiguousCursor>::value,
+                              "Cursor must be contiguous");
+
+                if(cur.empty())
+                {
+                    return nullptr;
+                }
+
+                return details::iterator_to_address(cur.begin());
+            }
+        };
+
+        struct to_pointer_cursor_fn
+        {
+            template <class ContiguousCursor>
+            pointer_cursor_type<std::remove_pointer_t<contiguous_pointer_t<ContiguousCursor>>>
+            operator()(ContiguousCursor const & cur) const
+            {
+                auto const first = cursor_data_fn{}(cur);
+
+                using Result = pointer_cursor_type<std::remove_pointer_t<contiguous_pointer_t<ContiguousCursor>>>;
+                return Result(first, first + cur.size());
+            }
+        };
+    }
+    // namespace details
+    /// @endcond
+
+    namespace
+    {
+        /** @brief Функциональный объект, возвращающий указатель на первый
+        непройденный элемент курсора с непрерывным размещением или нулевой
+        указатель, если курсор пуст.
+        */
+        constexpr auto const & cursor_data = static_const<details::cursor_data_fn>;
+
+        /** @brief Функциональный объект, создающий курсор на основе указателей,
+        проходящий те же элементы, что и непройденная часть курсора с
+        непрерывным размещением.
+        @details Продвинуть исходный курсор вслед за курсором на основе
+        указателей можно с помощью <tt> cur += n </tt>, при этом пройденная
+        часть исходного курсора сохраняется.
+        */
+        constexpr auto const & to_pointer_cursor = static_const<details::to_pointer_cursor_fn>;
+    }
+}
+// namespace v1
+}
+// namespace sayan
+
+#endif
+// Z_SAYAN_CURSOR_CONTIGUOUS_HPP_INCLUDED
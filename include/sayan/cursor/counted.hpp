@@ -0,0 +1,232 @@
+#ifndef Z_SAYAN_CURSOR_COUNTED_HPP_INCLUDED
+#define Z_SAYAN_CURSOR_COUNTED_HPP_INCLUDED
+
+/** @file sayan/cursor/counted.hpp
+ @brief Курсор, проходящий заданное количество элементов базового курсора
+ @details Для базовых курсоров известного размера исчерпание такого курсора
+ определяется только по счётчику оставшихся элементов, поэтому каждый шаг
+ сводится к одному уменьшению счётчика и одной проверке.
+*/
+
+#include <sayan/cursor/contiguous.hpp>
+#include <sayan/cursor/defs.hpp>
+#include <sayan/utility/static_const.hpp>
+#include <sayan/utility/with_old_value.hpp>
+
+#include <limits>
+#include <type_traits>
+
+namespace sayan
+{
+inline namespace v1
+{
+    /** @brief Курсор, проходящий первые @c n элементов базового курсора
+    @tparam Cursor тип базового курсора
+    @details Если базовый курсор сообщает свой размер, он должен содержать не
+    менее @c n элементов, и исчерпание определяется только по счётчику. Для
+    остальных курсоров (потоков ввода, списков) проверяется также исчерпание
+    базового курсора; если оно известно во время компиляции (например, у
+    неограниченного курсора), остаётся одна проверка счётчика.
+    */
+    template <class Cursor>
+    class counted_cursor_type
+    {
+    public:
+        // Типы
+        using reference = typename Cursor::reference;
+        using difference_type = difference_type_t<Cursor>;
+
+        // Создание
+        /** @brief Конструктор
+        @param cur базовый курсор
+        @param n количество элементов
+        @pre Если @c Cursor сообщает свой размер, то @c cur содержит не менее
+        @c n элементов
+        @post <tt> this->count() == n </tt>
+        */
+        explicit counted_cursor_type(Cursor cur, difference_type n)
+         : base_(std::move(cur))
+         , count_(n)
+        {}
+
+        // Однопроходный курсор
+        bool empty() const
+        {
+            return this->count_.value() == 0
+                   || this->base_empty(is_sized_cursor<Cursor>{});
+        }
+
+        reference operator[](::sayan::front_fn) const
+        {
+            return this->base_[::sayan::front];
+        }
+
+        void drop(::sayan::front_fn)
+        {
+            this->base_.drop(::sayan::front);
+            -- this->count_.value();
+        }
+
+        // Прямой курсор
+        counted_cursor_type traversed(::sayan::front_fn) const
+        {
+            return counted_cursor_type(this->base_.traversed(::sayan::front),
+                                       this->count_.old_value() - this->count_.value());
+        }
+
+        void forget(::sayan::front_fn)
+        {
+            this->base_.forget(::sayan::front);
+            this->count_.commit();
+        }
+
+        void exhaust(::sayan::front_fn)
+        {
+            this->exhaust_impl(is_sized_cursor<Cursor>{});
+        }
+
+        // Курсор произвольного доступа
+        void drop(::sayan::front_fn, difference_type n)
+        {
+            this->base_.drop(::sayan::front, n);
+            this->count_.value() -= n;
+        }
+
+        reference operator[](difference_type index) const
+        {
+            return this->base_[index];
+        }
+
+        difference_type size() const
+        {
+            return this->count_.value();
+        }
+
+        // Итераторы
+        auto begin() const
+        {
+            return this->base_.begin();
+        }
+
+        auto traversed_begin() const
+        {
+            return this->base_.traversed_begin();
+        }
+
+        // Адаптор курсора
+        /// @brief Количество элементов, которое осталось пройти
+        difference_type count() const
+        {
+            return this->count_.value();
+        }
+
+        Cursor const & base() const &
+        {
+            return this->base_;
+        }
+
+        Cursor && base() &&
+        {
+            return std::move(this->base_);
+        }
+
+    private:
+        bool base_empty(std::true_type) const
+        {
+            return false;
+        }
+
+        bool base_empty(std::false_type) const
+        {
+            return this->base_.empty();
+        }
+
+        void exhaust_impl(std::true_type)
+        {
+            this->drop(::sayan::front_fn{}, this->count_.value());
+        }
+
+        void exhaust_impl(std::false_type)
+        {
+            for(; !this->empty(); this->drop(::sayan::front_fn{}))
+            {}
+        }
+
+    private:
+        Cursor base_;
+        ::sayan::with_old_value<difference_type> count_;
+    };
+
+    template <class Cursor>
+    struct is_sized_cursor<counted_cursor_type<Cursor>>
+     : is_sized_cursor<Cursor>
+    {};
+
+    template <class Cursor>
+    struct is_contiguous_cursor<counted_cursor_type<Cursor>>
+     : is_contiguous_cursor<Cursor>
+    {};
+
+    /// @cond false
+    namespace details
+    {
+        struct counted_cursor_fn
+        {
+            template <class Cursor>
+            counted_cursor_type<Cursor>
+            operator()(Cursor cur, difference_type_t<Cursor> n) const
+            {
+                return counted_cursor_type<Cursor>(std::move(cur), n);
+            }
+        };
+
+        /* Количество элементов, которое обработает алгоритм с суффиксом _n:
+        не больше, чем осталось в курсоре размера size, и не меньше нуля.
+        */
+        template <class Size, class Difference>
+        Difference clamp_count(Size n, Difference size)
+        {
+            using Common = std::common_type_t<Size, Difference>;
+
+            if(!(n > Size{0}))
+            {
+                return Difference{0};
+            }
+
+            if(static_cast<Common>(size) < static_cast<Common>(n))
+            {
+                return size;
+            }
+
+            return static_cast<Difference>(n);
+        }
+
+        /* Количество элементов для курсора неизвестного размера: отрицательное
+        заменяется нулём, слишком большое -- наибольшим значением типа
+        расстояния
+        */
+        template <class Cursor, class Size>
+        difference_type_t<Cursor> max_count(Size n)
+        {
+            using Difference = difference_type_t<Cursor>;
+
+            return details::clamp_count(n, std::numeric_limits<Difference>::max());
+        }
+    }
+    // namespace details
+    /// @endcond
+
+    namespace
+    {
+        /** @brief Функциональный объект для создания курсора, проходящего
+        заданное количество элементов базового курсора
+        */
+        constexpr auto const & counted_cursor = static_const<details::counted_cursor_fn>;
+    }
+}
+// namespace v1
+}
+// namespace sayan
+
+#endif
+// Z_SAYAN_CURSOR_COUNTED_HPP_INCLUDED
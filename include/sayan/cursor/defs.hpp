@@ -48,6 +48,13 @@ inline namespace v1
         public:
             using type = decltype(is_cursor::test<T>(nullptr));
         };
+
+        // Количество элементов, пройденных курсором с произвольным доступом
+        template <class Cursor>
+        auto traversed_size(Cursor const & cur)
+        {
+            return cur.begin() - cur.traversed_begin();
+        }
     }
     // namespace details
     /// @endcond
@@ -100,6 +107,19 @@ inline namespace v1
     template <class T>
     using difference_type_t = typename cursor_traits<T>::difference_type;
 
+    /** @brief Проверка того, что курсор за постоянное время сообщает
+    количество непройденных элементов (с помощью функции-члена @c size)
+    */
+    template <class Cursor>
+    struct is_sized_cursor
+     : std::false_type
+    {};
+
+    template <class Cursor>
+    struct is_sized_cursor<Cursor const>
+     : is_sized_cursor<Cursor>
+    {};
+
     template <class Cursor, class = std::enable_if_t<is_cursor<Cursor>::value>>
     Cursor &
     operator+=(Cursor & cur, difference_type_t<Cursor> n)
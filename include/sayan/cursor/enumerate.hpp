@@ -0,0 +1,165 @@
+#ifndef Z_SAYAN_CURSOR_ENUMERATE_HPP_INCLUDED
+#define Z_SAYAN_CURSOR_ENUMERATE_HPP_INCLUDED
+
+/** @file sayan/cursor/enumerate.hpp
+ @brief Курсор, возвращающий пары из номера элемента и ссылки на элемент
+ базового курсора
+ @details Категория курсора совпадает с категорией базового курсора.
+*/
+
+#include <sayan/cursor/defs.hpp>
+#include <sayan/cursor/sequence_to_cursor.hpp>
+#include <sayan/utility/static_const.hpp>
+#include <sayan/utility/with_old_value.hpp>
+
+#include <utility>
+
+namespace sayan
+{
+inline namespace v1
+{
+    /** @brief Курсор, возвращающий пары из номера элемента и ссылки на элемент
+    базового курсора
+    @tparam Cursor тип базового курсора
+    */
+    template <class Cursor>
+    class enumerate_cursor_type
+    {
+        friend enumerate_cursor_type cursor_hook(enumerate_cursor_type cur, adl_tag)
+        {
+            auto const first = cur.index();
+            return enumerate_cursor_type(::sayan::cursor(std::move(cur.base_)), first);
+        }
+
+    public:
+        // Типы
+        using difference_type = difference_type_t<Cursor>;
+        using reference = std::pair<difference_type, typename Cursor::reference>;
+
+        // Создание
+        /** @brief Конструктор
+        @param cur базовый курсор
+        @param first номер первого элемента
+        */
+        explicit enumerate_cursor_type(Cursor cur, difference_type first = difference_type{0})
+         : base_(std::move(cur))
+         , index_(first)
+        {}
+
+        // Однопроходный курсор
+        bool empty() const
+        {
+            return this->base_.empty();
+        }
+
+        reference operator[](::sayan::front_fn) const
+        {
+            return reference(this->index_.value(), this->base_[::sayan::front]);
+        }
+
+        void drop(::sayan::front_fn)
+        {
+            this->base_.drop(::sayan::front);
+            ++ this->index_.value();
+        }
+
+        // Прямой курсор
+        enumerate_cursor_type traversed(::sayan::front_fn) const
+        {
+            return enumerate_cursor_type(this->base_.traversed(::sayan::front),
+                                         this->index_.old_value());
+        }
+
+        void forget(::sayan::front_fn)
+        {
+            this->base_.forget(::sayan::front);
+            this->index_.commit();
+        }
+
+        // Двунаправленный курсор
+        reference operator[](::sayan::back_fn) const
+        {
+            return reference(this->index_.value() + this->base_.size() - 1,
+                             this->base_[::sayan::back]);
+        }
+
+        void drop(::sayan::back_fn)
+        {
+            this->base_.drop(::sayan::back);
+        }
+
+        // Курсор произвольного доступа
+        void drop(::sayan::front_fn, difference_type n)
+        {
+            this->base_.drop(::sayan::front, n);
+            this->index_.value() += n;
+        }
+
+        reference operator[](difference_type index) const
+        {
+            return reference(this->index_.value() + index, this->base_[index]);
+        }
+
+        difference_type size() const
+        {
+            return this->base_.size();
+        }
+
+        // Адаптор курсора
+        Cursor const & base() const &
+        {
+            return this->base_;
+        }
+
+        Cursor && base() &&
+        {
+            return std::move(this->base_);
+        }
+
+        /// @brief Номер первого непройденного элемента
+        difference_type index() const
+        {
+            return this->index_.value();
+        }
+
+    private:
+        Cursor base_;
+        ::sayan::with_old_value<difference_type> index_;
+    };
+
+    template <class Cursor>
+    struct is_sized_cursor<enumerate_cursor_type<Cursor>>
+     : is_sized_cursor<Cursor>
+    {};
+
+    /// @cond false
+    namespace details
+    {
+        struct enumerate_cursor_fn
+        {
+            template <class Sequence>
+            ::sayan::enumerate_cursor_type<cursor_type_t<Sequence>>
+            operator()(Sequence && seq) const
+            {
+                using Result = ::sayan::enumerate_cursor_type<cursor_type_t<Sequence>>;
+                return Result(::sayan::cursor_fwd<Sequence>(seq));
+            }
+        };
+    }
+    // namespace details
+    /// @endcond
+
+    namespace
+    {
+        /** @brief Функциональный объект для создания курсора, возвращающего
+        пары из номера элемента и ссылки на элемент последовательности
+        */
+        constexpr auto const & enumerate_cursor = static_const<details::enumerate_cursor_fn>;
+    }
+}
+// namespace v1
+}
+// namespace sayan
+
+#endif
+// Z_SAYAN_CURSOR_ENUMERATE_HPP_INCLUDED
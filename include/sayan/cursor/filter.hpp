@@ -0,0 +1,150 @@
+#ifndef Z_SAYAN_CURSOR_FILTER_HPP_INCLUDED
+#define Z_SAYAN_CURSOR_FILTER_HPP_INCLUDED
+
+/** @file sayan/cursor/filter.hpp
+ @brief Курсор, проходящий только те элементы базового курсора, которые
+ удовлетворяют предикату
+ @details Элементы проверяются по мере продвижения курсора, отобранные
+ элементы не копируются. Курсор является прямым, если базовый курсор прямой,
+ и курсором ввода в остальных случаях.
+*/
+
+#include <sayan/cursor/defs.hpp>
+#include <sayan/cursor/sequence_to_cursor.hpp>
+#include <sayan/utility/function_holder.hpp>
+#include <sayan/utility/static_const.hpp>
+
+#include <utility>
+
+namespace sayan
+{
+inline namespace v1
+{
+    /** @brief Курсор, проходящий элементы базового курсора, удовлетворяющие
+    предикату
+    @tparam Cursor тип базового курсора
+    @tparam UnaryPredicate тип предиката
+    @invariant <tt> this->empty() || pred(*this->base()) </tt>
+    */
+    template <class Cursor, class UnaryPredicate>
+    class filter_cursor_type
+    {
+        friend filter_cursor_type cursor_hook(filter_cursor_type cur, adl_tag)
+        {
+            auto const & pred = cur.predicate();
+            return filter_cursor_type(::sayan::cursor(std::move(cur.base_)), pred);
+        }
+
+    public:
+        // Типы
+        using reference = typename Cursor::reference;
+        using difference_type = difference_type_t<Cursor>;
+
+        // Создание
+        /** @brief Конструктор
+        @param cur базовый курсор
+        @param pred предикат
+        @post Элементы @c cur, предшествующие первому элементу,
+        удовлетворяющему @c pred, пропущены
+        */
+        explicit filter_cursor_type(Cursor cur, UnaryPredicate pred)
+         : base_(std::move(cur))
+         , pred_(std::move(pred))
+        {
+            this->seek();
+        }
+
+        // Однопроходный курсор
+        bool empty() const
+        {
+            return this->base_.empty();
+        }
+
+        reference operator[](::sayan::front_fn) const
+        {
+            return this->base_[::sayan::front];
+        }
+
+        void drop(::sayan::front_fn)
+        {
+            this->base_.drop(::sayan::front);
+            this->seek();
+        }
+
+        // Прямой курсор
+        filter_cursor_type traversed(::sayan::front_fn) const
+        {
+            return filter_cursor_type(this->base_.traversed(::sayan::front), this->predicate());
+        }
+
+        void forget(::sayan::front_fn)
+        {
+            this->base_.forget(::sayan::front);
+        }
+
+        void exhaust(::sayan::front_fn)
+        {
+            this->base_.exhaust(::sayan::front);
+        }
+
+        // Адаптор курсора
+        Cursor const & base() const &
+        {
+            return this->base_;
+        }
+
+        Cursor && base() &&
+        {
+            return std::move(this->base_);
+        }
+
+        UnaryPredicate const & predicate() const
+        {
+            return this->pred_.function();
+        }
+
+    private:
+        void seek()
+        {
+            for(; !this->base_.empty() && !this->predicate()(this->base_[::sayan::front]);)
+            {
+                this->base_.drop(::sayan::front);
+            }
+        }
+
+    private:
+        Cursor base_;
+        ::sayan::function_holder<UnaryPredicate> pred_;
+    };
+
+    /// @cond false
+    namespace details
+    {
+        struct filter_cursor_fn
+        {
+            template <class Sequence, class UnaryPredicate>
+            ::sayan::filter_cursor_type<cursor_type_t<Sequence>, UnaryPredicate>
+            operator()(Sequence && seq, UnaryPredicate pred) const
+            {
+                using Result = ::sayan::filter_cursor_type<cursor_type_t<Sequence>, UnaryPredicate>;
+                return Result(::sayan::cursor_fwd<Sequence>(seq), std::move(pred));
+            }
+        };
+    }
+    // namespace details
+    /// @endcond
+
+    namespace
+    {
+        /** @brief Функциональный объект для создания курсора, проходящего
+        элементы последовательности, удовлетворяющие предикату
+        */
+        constexpr auto const & filter_cursor = static_const<details::filter_cursor_fn>;
+    }
+}
+// namespace v1
+}
+// namespace sayan
+
+#endif
+// Z_SAYAN_CURSOR_FILTER_HPP_INCLUDED
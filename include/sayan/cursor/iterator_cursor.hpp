@@ -5,6 +5,8 @@
 #include <sayan/cursor/check_policies.hpp>
 #include <sayan/utility/with_old_value.hpp>
 
+#include <iterator>
+
 namespace sayan
 {
 inline namespace v1
@@ -109,6 +111,13 @@ inline namespace v1
             return iterator_cursor_type(this->end_.value(), this->end_.old_value());
         }
 
+        void drop(sayan::back_fn, difference_type n)
+        {
+            Check::check_step(*this, n);
+
+            this->end_.value() -= n;
+        }
+
         // Курсор произвольного доступа
         reference operator[](difference_type index) const
         {
@@ -147,6 +156,12 @@ inline namespace v1
         ::sayan::with_old_value<Iterator> begin_;
         ::sayan::with_old_value<Sentinel> end_;
     };
+
+    template <class Iterator, class Check>
+    struct is_sized_cursor<iterator_cursor_type<Iterator, Iterator, Check>>
+     : std::is_convertible<typename std::iterator_traits<Iterator>::iterator_category,
+                           std::random_access_iterator_tag>
+    {};
 }
 // namespace v1
 }
@@ -0,0 +1,59 @@
+#ifndef Z_SAYAN_CURSOR_LAYOUT_HPP_INCLUDED
+#define Z_SAYAN_CURSOR_LAYOUT_HPP_INCLUDED
+
+/** @file sayan/cursor/layout.hpp
+ @brief Теги размещения элементов последовательности в памяти, используемые
+ алгоритмами для выбора реализации.
+*/
+
+#include <sayan/cursor/contiguous.hpp>
+#include <sayan/cursor/segmented.hpp>
+#include <sayan/cursor/strided.hpp>
+
+#include <type_traits>
+
+namespace sayan
+{
+inline namespace v1
+{
+    /// @brief Тег курсора, о размещении элементов которого ничего не известно
+    struct generic_layout_tag
+    {};
+
+    /// @brief Тег курсора последовательности с непрерывным размещением
+    struct contiguous_layout_tag
+     : generic_layout_tag
+    {};
+
+    /// @brief Тег курсора сегментированной последовательности
+    struct segmented_layout_tag
+     : generic_layout_tag
+    {};
+
+    /// @brief Тег курсора, проходящего элементы массива с постоянным шагом
+    struct strided_layout_tag
+     : generic_layout_tag
+    {};
+
+    /** @brief Тег размещения элементов, проходимых курсором
+    @details Так как теги специальных размещений являются производными от
+    @c generic_layout_tag, алгоритму достаточно предоставить перегрузку для
+    общего случая и перегрузки для тех размещений, которые он обрабатывает
+    особым образом.
+    */
+    template <class Cursor>
+    using cursor_layout_t
+        = std::conditional_t<is_segmented_cursor<Cursor>::value,
+                             segmented_layout_tag,
+                             std::conditional_t<is_contiguous_cursor<Cursor>::value,
+                                                contiguous_layout_tag,
+                                                std::conditional_t<is_strided_cursor<Cursor>::value,
+                                                                   strided_layout_tag,
+                                                                   generic_layout_tag>>>;
+}
+// namespace v1
+}
+// namespace sayan
+
+#endif
+// Z_SAYAN_CURSOR_LAYOUT_HPP_INCLUDED
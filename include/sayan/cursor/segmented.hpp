@@ -0,0 +1,218 @@
+#ifndef Z_SAYAN_CURSOR_SEGMENTED_HPP_INCLUDED
+#define Z_SAYAN_CURSOR_SEGMENTED_HPP_INCLUDED
+
+/** @file sayan/cursor/segmented.hpp
+ @brief Сегментированные курсоры: курсоры последовательностей, хранящихся в
+ памяти в виде нескольких непрерывных блоков (например, @c std::deque).
+ @details Иерархические алгоритмы проходят такие последовательности по
+ сегментам: внешний курсор перебирает сегменты, а каждый сегмент
+ обрабатывается с помощью внутреннего курсора, который не проверяет границы
+ сегментов при каждом продвижении.
+*/
+
+#include <sayan/cursor/contiguous.hpp>
+#include <sayan/cursor/iterator_cursor.hpp>
+#include <sayan/cursor/check_policies.hpp>
+#include <sayan/utility/static_const.hpp>
+
+#include <deque>
+#include <iterator>
+#include <type_traits>
+
+namespace sayan
+{
+inline namespace v1
+{
+    /** @brief Свойства сегментированных итераторов
+    @details Первичный шаблон описывает несегментированные итераторы. Для
+    сегментированного итератора специализация должна определять:
+    - @c is_segmented_iterator -- @c std::true_type;
+    - @c segment_iterator -- тип итератора сегментов;
+    - @c local_iterator -- тип итератора элементов внутри сегмента;
+    - статические функции @c segment(i) и @c local(i), возвращающие сегмент,
+    содержащий элемент, на который указывает @c i, и итератор этого элемента
+    внутри сегмента;
+    - статические функции @c begin(s) и @c end(s), возвращающие границы
+    сегмента @c s.
+
+    Итератор, указывающий на позицию после последнего элемента сегмента, должен
+    быть представлен началом следующего сегмента.
+    */
+    template <class Iterator>
+    struct segmented_iterator_traits
+    {
+        using is_segmented_iterator = std::false_type;
+    };
+
+#if defined(__GLIBCXX__)
+    /** @brief Свойства итераторов @c std::deque из libstdc++
+    @details Только для libstdc++: специализация опирается на внутреннее
+    устройство её итератора (@c _M_node, @c _M_cur, @c _S_buffer_size),
+    которое не входит в стандарт. С другими реализациями стандартной
+    библиотеки итераторы @c std::deque не считаются сегментированными, и
+    алгоритмы проходят дек поэлементно.
+    */
+    template <class T, class Reference, class Pointer>
+    struct segmented_iterator_traits<std::_Deque_iterator<T, Reference, Pointer>>
+    {
+    private:
+        using iterator = std::_Deque_iterator<T, Reference, Pointer>;
+
+    public:
+        // Типы
+        using is_segmented_iterator = std::true_type;
+        using segment_iterator = typename iterator::_Map_pointer;
+        using local_iterator = Pointer;
+
+        // Разбиение итератора
+        static segment_iterator segment(iterator const & i)
+        {
+            return i._M_node;
+        }
+
+        static local_iterator local(iterator const & i)
+        {
+            return i._M_cur;
+        }
+
+        // Границы сегментов
+        static local_iterator begin(segment_iterator s)
+        {
+            return *s;
+        }
+
+        static local_iterator end(segment_iterator s)
+        {
+            return *s + iterator::_S_buffer_size();
+        }
+    };
+#endif
+
+    /** @brief Проверка того, что курсор проходит сегментированную
+    последовательность
+    */
+    template <class Cursor>
+    struct is_segmented_cursor
+     : std::false_type
+    {};
+
+    template <class Iterator, class Check>
+    struct is_segmented_cursor<iterator_cursor_type<Iterator, Iterator, Check>>
+     : segmented_iterator_traits<Iterator>::is_segmented_iterator
+    {};
+
+    template <class Cursor>
+    struct is_segmented_cursor<Cursor const>
+     : is_segmented_cursor<Cursor>
+    {};
+
+    /** @brief Внешний курсор сегментированной последовательности: курсор
+    ввода, элементами которого являются курсоры сегментов.
+    @tparam SegmentedIterator тип сегментированного итератора
+    @tparam Check стратегия проверок
+    */
+    template <class SegmentedIterator, class Check = cursor_checking_throw>
+    class segments_cursor
+    {
+        using Traits = segmented_iterator_traits<SegmentedIterator>;
+        using segment_iterator = typename Traits::segment_iterator;
+        using local_iterator = typename Traits::local_iterator;
+
+    public:
+        // Типы
+        using value_type = iterator_cursor_type<local_iterator>;
+        using reference = value_type;
+        using difference_type = typename std::iterator_traits<SegmentedIterator>::difference_type;
+
+        // Создание
+        /** @brief Конструктор
+        @param first начало интервала
+        @param last конец интервала
+        */
+        explicit segments_cursor(SegmentedIterator const & first,
+                                 SegmentedIterator const & last)
+         : segment_first_(Traits::segment(first))
+         , segment_last_(Traits::segment(last))
+         , local_first_(Traits::local(first))
+         , local_last_(Traits::local(last))
+        {}
+
+        // Курсор ввода
+        bool empty() const
+        {
+            return this->segment_first_ == this->segment_last_
+                   && this->local_first_ == this->local_last_;
+        }
+
+        /** @brief Курсор текущего сегмента
+        @pre <tt> !this->empty() </tt>
+        */
+        reference operator[](front_fn) const
+        {
+            Check::ensure_not_empty(*this);
+
+            if(this->segment_first_ == this->segment_last_)
+            {
+                return reference(this->local_first_, this->local_last_);
+            }
+            else
+            {
+                return reference(this->local_first_, Traits::end(this->segment_first_));
+            }
+        }
+
+        void drop(front_fn)
+        {
+            Check::ensure_not_empty(*this);
+
+            if(this->segment_first_ == this->segment_last_)
+            {
+                this->local_first_ = this->local_last_;
+            }
+            else
+            {
+                ++ this->segment_first_;
+                this->local_first_ = Traits::begin(this->segment_first_);
+            }
+        }
+
+    private:
+        segment_iterator segment_first_;
+        segment_iterator segment_last_;
+        local_iterator local_first_;
+        local_iterator local_last_;
+    };
+
+    /// @cond false
+    namespace details
+    {
+        struct segments_fn
+        {
+            template <class Iterator, class Check>
+            segments_cursor<Iterator, Check>
+            operator()(iterator_cursor_type<Iterator, Iterator, Check> const & cur) const
+            {
+                static_assert(::sayan::segmented_iterator_traits<Iterator>::is_segmented_iterator::value,
+                              "Cursor must be segmented");
+
+                return segments_cursor<Iterator, Check>(cur.begin(), cur.end());
+            }
+        };
+    }
+    // namespace details
+    /// @endcond
+
+    namespace
+    {
+        /** @brief Функциональный объект, создающий внешний курсор для
+        непройденной части сегментированного курсора.
+        */
+        constexpr auto const & segments = static_const<details::segments_fn>;
+    }
+}
+// namespace v1
+}
+// namespace sayan
+
+#endif
+// Z_SAYAN_CURSOR_SEGMENTED_HPP_INCLUDED
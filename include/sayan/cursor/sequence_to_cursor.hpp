@@ -23,6 +23,13 @@ inline namespace v1
         return Cursor{std::forward<Range>(r).begin(), std::forward<Range>(r).end()};
     }
 
+    template <class T, std::size_t N>
+    iterator_cursor_type<T *>
+    cursor_hook(T (&arr)[N], adl_tag)
+    {
+        return iterator_cursor_type<T *>(arr, arr + N);
+    }
+
     namespace details
     {
         using sayan::cursor_hook;
@@ -114,6 +121,55 @@ inline namespace v1
         }
     };
 
+    /// @cond false
+    namespace details
+    {
+        template <class Reference>
+        struct cursor_rvalue_reference
+        {
+            using type = Reference;
+        };
+
+        template <class T>
+        struct cursor_rvalue_reference<T &>
+        {
+            using type = T &&;
+        };
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Ссылка на первый элемент курсора, из которой можно перемещать
+    @details По умолчанию lvalue-ссылка преобразуется в rvalue-ссылку, а
+    значения и прокси-объекты возвращаются без изменений. Курсоры, у которых
+    разыменование возвращает прокси-объект, могут определить собственную
+    функцию @c cursor_move_hook, которая будет найдена поиском, зависящим от
+    аргументов.
+    */
+    template <class Cursor, class = std::enable_if_t<is_cursor<Cursor>::value>>
+    auto cursor_move_hook(Cursor const & cur, adl_tag)
+    -> typename details::cursor_rvalue_reference<decltype(*cur)>::type
+    {
+        using Result = typename details::cursor_rvalue_reference<decltype(*cur)>::type;
+        return static_cast<Result>(*cur);
+    }
+
+    namespace details
+    {
+        using sayan::cursor_move_hook;
+
+        struct cursor_move_fn
+        {
+            template <class Cursor>
+            auto operator()(Cursor const & cur) const
+            -> decltype(cursor_move_hook(cur, adl_tag{}))
+            {
+                return cursor_move_hook(cur, adl_tag{});
+            }
+        };
+    }
+    // namespace details
+
     struct next_fn
     {
         template <class Cursor>
@@ -144,7 +200,11 @@ inline namespace v1
         constexpr auto const & next = static_const<next_fn>;
         constexpr auto const & cursor_swap = static_const<cursor_swap_fn>;
         constexpr auto const & cursor_from_parts = static_const<cursor_from_parts_fn>;
+        constexpr auto const & cursor_move = static_const<details::cursor_move_fn>;
     }
+
+    template <class Cursor>
+    using cursor_rvalue_reference_t = decltype(::sayan::cursor_move(std::declval<Cursor const &>()));
 }
 // namespace v1
 }
@@ -0,0 +1,268 @@
+#ifndef Z_SAYAN_CURSOR_STRIDED_HPP_INCLUDED
+#define Z_SAYAN_CURSOR_STRIDED_HPP_INCLUDED
+
+/** @file sayan/cursor/strided.hpp
+ @brief Курсор, проходящий элементы массива с постоянным шагом (например,
+ столбец матрицы, хранящейся по строкам, или один канал чередующихся отсчётов).
+*/
+
+#include <sayan/cursor/contiguous.hpp>
+#include <sayan/cursor/defs.hpp>
+#include <sayan/cursor/check_policies.hpp>
+#include <sayan/utility/static_const.hpp>
+#include <sayan/utility/with_old_value.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace sayan
+{
+inline namespace v1
+{
+    /** @brief Курсор произвольного доступа, проходящий элементы
+    <tt> data[0], data[stride], ..., data[(n-1)*stride] </tt>
+    @tparam T тип элементов (возможно, константный)
+    @tparam Check стратегия проверок
+    */
+    template <class T, class Check = cursor_checking_throw>
+    class strided_cursor_type
+    {
+        friend strided_cursor_type cursor_hook(strided_cursor_type cur, adl_tag)
+        {
+            cur.forget(::sayan::front_fn{});
+
+            return cur;
+        }
+
+    public:
+        // Типы
+        using value_type = std::remove_const_t<T>;
+        using reference = T &;
+        using pointer = T *;
+        using difference_type = std::ptrdiff_t;
+
+        // Создание
+        /** @brief Конструктор
+        @param data указатель на первый элемент
+        @param stride шаг, измеряемый в элементах
+        @param n количество элементов
+        @pre <tt> stride > 0 </tt>
+        @pre Элементы <tt> data[i * stride] </tt> существуют для всех
+        <tt> 0 <= i < n </tt>
+        @post <tt> this->size() == n </tt>
+        */
+        explicit strided_cursor_type(T * data, difference_type stride, difference_type n)
+         : data_(data)
+         , stride_(stride)
+         , first_(0)
+         , last_(n)
+        {}
+
+        // Однопроходный курсор
+        bool empty() const
+        {
+            return this->first_.value() == this->last_.value();
+        }
+
+        reference operator[](::sayan::front_fn) const
+        {
+            Check::ensure_not_empty(*this);
+
+            return this->data_[this->first_.value() * this->stride_];
+        }
+
+        void drop(::sayan::front_fn)
+        {
+            Check::ensure_not_empty(*this);
+
+            ++ this->first_.value();
+        }
+
+        void drop(::sayan::front_fn, difference_type n)
+        {
+            Check::check_step(*this, n);
+
+            this->first_.value() += n;
+        }
+
+        // Прямой курсор
+        strided_cursor_type traversed(::sayan::front_fn) const
+        {
+            return this->subcursor(this->first_.old_value(), this->first_.value());
+        }
+
+        void forget(::sayan::front_fn)
+        {
+            this->first_.commit();
+            this->last_.commit();
+        }
+
+        void exhaust(::sayan::front_fn)
+        {
+            this->first_.value() = this->last_.value();
+        }
+
+        // Двунаправленный курсор
+        reference operator[](::sayan::back_fn) const
+        {
+            Check::ensure_not_empty(*this);
+
+            return this->data_[(this->last_.value() - 1) * this->stride_];
+        }
+
+        void drop(::sayan::back_fn)
+        {
+            Check::ensure_not_empty(*this);
+
+            -- this->last_.value();
+        }
+
+        strided_cursor_type traversed(::sayan::back_fn) const
+        {
+            return this->subcursor(this->last_.value(), this->last_.old_value());
+        }
+
+        // Курсор произвольного доступа
+        reference operator[](difference_type index) const
+        {
+            Check::check_index(*this, index);
+
+            return this->data_[(this->first_.value() + index) * this->stride_];
+        }
+
+        difference_type size() const
+        {
+            return this->last_.value() - this->first_.value();
+        }
+
+        // Размещение элементов
+        /** @brief Указатель на первый непройденный элемент
+        @pre <tt> !this->empty() </tt>
+        */
+        pointer data() const
+        {
+            return this->data_ + this->first_.value() * this->stride_;
+        }
+
+        /// @brief Шаг между соседними элементами, измеряемый в элементах
+        difference_type stride() const
+        {
+            return this->stride_;
+        }
+
+        /// @brief Количество пройденных элементов
+        difference_type traversed_size() const
+        {
+            return this->first_.value() - this->first_.old_value();
+        }
+
+    private:
+        strided_cursor_type subcursor(difference_type first, difference_type last) const
+        {
+            return strided_cursor_type(this->data_ + first * this->stride_,
+                                       this->stride_, last - first);
+        }
+
+    private:
+        T * data_;
+        difference_type stride_;
+        ::sayan::with_old_value<difference_type> first_;
+        ::sayan::with_old_value<difference_type> last_;
+    };
+
+    template <class T, class Check>
+    struct is_sized_cursor<strided_cursor_type<T, Check>>
+     : std::true_type
+    {};
+
+    /// @brief Проверка того, что курсор проходит элементы с постоянным шагом
+    template <class Cursor>
+    struct is_strided_cursor
+     : std::false_type
+    {};
+
+    template <class T, class Check>
+    struct is_strided_cursor<strided_cursor_type<T, Check>>
+     : std::true_type
+    {};
+
+    template <class Cursor>
+    struct is_strided_cursor<Cursor const>
+     : is_strided_cursor<Cursor>
+    {};
+
+    /// @cond false
+    namespace details
+    {
+        /* Копирует блоки элементов, расположенных с постоянным шагом, в
+        локальный буфер, к которому алгоритмы применяют реализации для
+        непрерывных последовательностей. Элементы с единичным шагом
+        не копируются.
+        */
+        template <class T>
+        class strided_gather
+        {
+        public:
+            static constexpr std::ptrdiff_t block_size = 256;
+
+            strided_gather(T * data, std::ptrdiff_t stride)
+             : data_(data)
+             , stride_(stride)
+            {}
+
+            /** Возвращает указатель на n элементов, начиная с элемента с номером offset
+            @pre <tt> 0 < n && n <= block_size </tt>
+            */
+            T * block(std::ptrdiff_t offset, std::ptrdiff_t n)
+            {
+                if(this->stride_ == 1)
+                {
+                    return this->data_ + offset;
+                }
+
+                auto const first = this->data_ + offset * this->stride_;
+
+                for(std::ptrdiff_t i = 0; i != n; ++ i)
+                {
+                    this->buffer_[i] = first[i * this->stride_];
+                }
+
+                return this->buffer_;
+            }
+
+        private:
+            T * data_;
+            std::ptrdiff_t stride_;
+            std::remove_cv_t<T> buffer_[block_size];
+        };
+
+        template <class T>
+        constexpr std::ptrdiff_t strided_gather<T>::block_size;
+
+        struct strided_cursor_fn
+        {
+            template <class T>
+            ::sayan::strided_cursor_type<T>
+            operator()(T * data, std::ptrdiff_t stride, std::ptrdiff_t n) const
+            {
+                return ::sayan::strided_cursor_type<T>(data, stride, n);
+            }
+        };
+    }
+    // namespace details
+    /// @endcond
+
+    namespace
+    {
+        /** @brief Функциональный объект для создания курсора, проходящего
+        @c n элементов массива, начиная с @c data, с шагом @c stride
+        */
+        constexpr auto const & strided_cursor = static_const<details::strided_cursor_fn>;
+    }
+}
+// namespace v1
+}
+// namespace sayan
+
+#endif
+// Z_SAYAN_CURSOR_STRIDED_HPP_INCLUDED
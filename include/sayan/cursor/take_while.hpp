@@ -0,0 +1,134 @@
+#ifndef Z_SAYAN_CURSOR_TAKE_WHILE_HPP_INCLUDED
+#define Z_SAYAN_CURSOR_TAKE_WHILE_HPP_INCLUDED
+
+/** @file sayan/cursor/take_while.hpp
+ @brief Курсор, проходящий элементы базового курсора до первого элемента, не
+ удовлетворяющего предикату
+ @details Курсор является прямым, если базовый курсор прямой, и курсором ввода
+ в остальных случаях.
+*/
+
+#include <sayan/cursor/defs.hpp>
+#include <sayan/cursor/sequence_to_cursor.hpp>
+#include <sayan/utility/function_holder.hpp>
+#include <sayan/utility/static_const.hpp>
+
+#include <utility>
+
+namespace sayan
+{
+inline namespace v1
+{
+    /** @brief Курсор, проходящий начальные элементы базового курсора,
+    удовлетворяющие предикату
+    @tparam Cursor тип базового курсора
+    @tparam UnaryPredicate тип предиката
+    */
+    template <class Cursor, class UnaryPredicate>
+    class take_while_cursor_type
+    {
+        friend take_while_cursor_type cursor_hook(take_while_cursor_type cur, adl_tag)
+        {
+            auto const & pred = cur.predicate();
+            return take_while_cursor_type(::sayan::cursor(std::move(cur.base_)), pred);
+        }
+
+    public:
+        // Типы
+        using reference = typename Cursor::reference;
+        using difference_type = difference_type_t<Cursor>;
+
+        // Создание
+        explicit take_while_cursor_type(Cursor cur, UnaryPredicate pred)
+         : base_(std::move(cur))
+         , pred_(std::move(pred))
+        {}
+
+        // Однопроходный курсор
+        /** @brief Проверка исчерпания
+        @return <tt> this->base().empty() || !pred(*this->base()) </tt>
+        */
+        bool empty() const
+        {
+            return this->base_.empty() || !this->predicate()(this->base_[::sayan::front]);
+        }
+
+        reference operator[](::sayan::front_fn) const
+        {
+            return this->base_[::sayan::front];
+        }
+
+        void drop(::sayan::front_fn)
+        {
+            this->base_.drop(::sayan::front);
+        }
+
+        // Прямой курсор
+        take_while_cursor_type traversed(::sayan::front_fn) const
+        {
+            return take_while_cursor_type(this->base_.traversed(::sayan::front), this->predicate());
+        }
+
+        void forget(::sayan::front_fn)
+        {
+            this->base_.forget(::sayan::front);
+        }
+
+        void exhaust(::sayan::front_fn)
+        {
+            for(; !this->empty(); this->drop(::sayan::front))
+            {}
+        }
+
+        // Адаптор курсора
+        Cursor const & base() const &
+        {
+            return this->base_;
+        }
+
+        Cursor && base() &&
+        {
+            return std::move(this->base_);
+        }
+
+        UnaryPredicate const & predicate() const
+        {
+            return this->pred_.function();
+        }
+
+    private:
+        Cursor base_;
+        ::sayan::function_holder<UnaryPredicate> pred_;
+    };
+
+    /// @cond false
+    namespace details
+    {
+        struct take_while_cursor_fn
+        {
+            template <class Sequence, class UnaryPredicate>
+            ::sayan::take_while_cursor_type<cursor_type_t<Sequence>, UnaryPredicate>
+            operator()(Sequence && seq, UnaryPredicate pred) const
+            {
+                using Result = ::sayan::take_while_cursor_type<cursor_type_t<Sequence>, UnaryPredicate>;
+                return Result(::sayan::cursor_fwd<Sequence>(seq), std::move(pred));
+            }
+        };
+    }
+    // namespace details
+    /// @endcond
+
+    namespace
+    {
+        /** @brief Функциональный объект для создания курсора, проходящего
+        начальные элементы последовательности, удовлетворяющие предикату
+        */
+        constexpr auto const & take_while_cursor = static_const<details::take_while_cursor_fn>;
+    }
+}
+// namespace v1
+}
+// namespace sayan
+
+#endif
+// Z_SAYAN_CURSOR_TAKE_WHILE_HPP_INCLUDED
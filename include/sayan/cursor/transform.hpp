@@ -0,0 +1,176 @@
+#ifndef Z_SAYAN_CURSOR_TRANSFORM_HPP_INCLUDED
+#define Z_SAYAN_CURSOR_TRANSFORM_HPP_INCLUDED
+
+/** @file sayan/cursor/transform.hpp
+ @brief Курсор, возвращающий результаты применения функции к элементам
+ базового курсора
+ @details Функция применяется при обращении к элементу, поэтому
+ преобразованная последовательность не сохраняется в памяти, а цепочка
+ адаптеров и алгоритм выполняются за один проход. Категория курсора
+ совпадает с категорией базового курсора.
+*/
+
+#include <sayan/cursor/defs.hpp>
+#include <sayan/cursor/sequence_to_cursor.hpp>
+#include <sayan/utility/function_holder.hpp>
+#include <sayan/utility/static_const.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace sayan
+{
+inline namespace v1
+{
+    /** @brief Курсор, возвращающий результаты применения функции к элементам
+    базового курсора
+    @tparam Cursor тип базового курсора
+    @tparam UnaryFunction тип функции
+    */
+    template <class Cursor, class UnaryFunction>
+    class transform_cursor_type
+    {
+        friend transform_cursor_type cursor_hook(transform_cursor_type cur, adl_tag)
+        {
+            auto const & f = cur.function();
+            return transform_cursor_type(::sayan::cursor(std::move(cur.base_)), f);
+        }
+
+    public:
+        // Типы
+        using reference = decltype(std::declval<UnaryFunction const &>()(std::declval<typename Cursor::reference>()));
+        using value_type = std::decay_t<reference>;
+        using difference_type = difference_type_t<Cursor>;
+
+        // Создание
+        explicit transform_cursor_type(Cursor cur, UnaryFunction f)
+         : base_(std::move(cur))
+         , f_(std::move(f))
+        {}
+
+        // Однопроходный курсор
+        bool empty() const
+        {
+            return this->base_.empty();
+        }
+
+        reference operator[](::sayan::front_fn) const
+        {
+            return this->f_.function()(this->base_[::sayan::front]);
+        }
+
+        void drop(::sayan::front_fn)
+        {
+            this->base_.drop(::sayan::front);
+        }
+
+        // Прямой курсор
+        transform_cursor_type traversed(::sayan::front_fn) const
+        {
+            return transform_cursor_type(this->base_.traversed(::sayan::front), this->function());
+        }
+
+        void forget(::sayan::front_fn)
+        {
+            this->base_.forget(::sayan::front);
+        }
+
+        void exhaust(::sayan::front_fn)
+        {
+            this->base_.exhaust(::sayan::front);
+        }
+
+        void splice(transform_cursor_type other)
+        {
+            this->base_.splice(std::move(other.base_));
+        }
+
+        // Двунаправленный курсор
+        reference operator[](::sayan::back_fn) const
+        {
+            return this->f_.function()(this->base_[::sayan::back]);
+        }
+
+        void drop(::sayan::back_fn)
+        {
+            this->base_.drop(::sayan::back);
+        }
+
+        transform_cursor_type traversed(::sayan::back_fn) const
+        {
+            return transform_cursor_type(this->base_.traversed(::sayan::back), this->function());
+        }
+
+        // Курсор произвольного доступа
+        void drop(::sayan::front_fn, difference_type n)
+        {
+            this->base_.drop(::sayan::front, n);
+        }
+
+        reference operator[](difference_type index) const
+        {
+            return this->f_.function()(this->base_[index]);
+        }
+
+        difference_type size() const
+        {
+            return this->base_.size();
+        }
+
+        // Адаптор курсора
+        Cursor const & base() const &
+        {
+            return this->base_;
+        }
+
+        Cursor && base() &&
+        {
+            return std::move(this->base_);
+        }
+
+        UnaryFunction const & function() const
+        {
+            return this->f_.function();
+        }
+
+    private:
+        Cursor base_;
+        ::sayan::function_holder<UnaryFunction> f_;
+    };
+
+    template <class Cursor, class UnaryFunction>
+    struct is_sized_cursor<transform_cursor_type<Cursor, UnaryFunction>>
+     : is_sized_cursor<Cursor>
+    {};
+
+    /// @cond false
+    namespace details
+    {
+        struct transform_cursor_fn
+        {
+            template <class Sequence, class UnaryFunction>
+            ::sayan::transform_cursor_type<cursor_type_t<Sequence>, UnaryFunction>
+            operator()(Sequence && seq, UnaryFunction f) const
+            {
+                using Result = ::sayan::transform_cursor_type<cursor_type_t<Sequence>, UnaryFunction>;
+                return Result(::sayan::cursor_fwd<Sequence>(seq), std::move(f));
+            }
+        };
+    }
+    // namespace details
+    /// @endcond
+
+    namespace
+    {
+        /** @brief Функциональный объект для создания курсора, возвращающего
+        результаты применения функции к элементам последовательности
+        */
+        constexpr auto const & transform_cursor = static_const<details::transform_cursor_fn>;
+    }
+}
+// namespace v1
+}
+// namespace sayan
+
+#endif
+// Z_SAYAN_CURSOR_TRANSFORM_HPP_INCLUDED
@@ -0,0 +1,127 @@
+#ifndef Z_SAYAN_CURSOR_UNBOUNDED_HPP_INCLUDED
+#define Z_SAYAN_CURSOR_UNBOUNDED_HPP_INCLUDED
+
+/** @file sayan/cursor/unbounded.hpp
+ @brief Неограниченный курсор: курсор, который никогда не бывает исчерпан.
+ @details Такой курсор полезен, когда известно, что алгоритм завершится до
+ выхода за пределы последовательности (например, искомый элемент заведомо
+ присутствует в последовательности). Так как проверка исчерпания всегда
+ возвращает @b false, компилятор исключает её из циклов алгоритмов.
+*/
+
+#include <sayan/cursor/defs.hpp>
+#include <sayan/utility/static_const.hpp>
+#include <sayan/utility/with_old_value.hpp>
+
+#include <iterator>
+
+namespace sayan
+{
+inline namespace v1
+{
+    /** @brief Неограниченный курсор на основе итератора
+    @tparam Iterator тип итератора
+    */
+    template <class Iterator>
+    class unbounded_cursor_type
+    {
+        friend unbounded_cursor_type cursor_hook(unbounded_cursor_type cur, adl_tag)
+        {
+            cur.forget(::sayan::front_fn{});
+
+            return cur;
+        }
+
+    public:
+        // Типы
+        using reference = typename std::iterator_traits<Iterator>::reference;
+        using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+
+        // Создание
+        /** @brief Конструктор
+        @param first итератор, задающий начало последовательности
+        @post <tt> this->begin() == first </tt>
+        */
+        explicit unbounded_cursor_type(Iterator first)
+         : begin_(std::move(first))
+        {}
+
+        // Однопроходный курсор
+        /** @brief Проверка исчерпания
+        @return @b false
+        */
+        constexpr bool empty() const
+        {
+            return false;
+        }
+
+        reference operator[](::sayan::front_fn) const
+        {
+            return *this->begin_.value();
+        }
+
+        void drop(::sayan::front_fn)
+        {
+            ++ this->begin_.value();
+        }
+
+        void drop(::sayan::front_fn, difference_type n)
+        {
+            this->begin_.value() += n;
+        }
+
+        // Прямой курсор
+        void forget(::sayan::front_fn)
+        {
+            this->begin_.commit();
+        }
+
+        // Курсор произвольного доступа
+        reference operator[](difference_type index) const
+        {
+            return this->begin()[index];
+        }
+
+        // Итераторы
+        Iterator begin() const
+        {
+            return this->begin_.value();
+        }
+
+        Iterator traversed_begin() const
+        {
+            return this->begin_.old_value();
+        }
+
+    private:
+        ::sayan::with_old_value<Iterator> begin_;
+    };
+
+    /// @cond false
+    namespace details
+    {
+        struct unbounded_cursor_fn
+        {
+            template <class Iterator>
+            ::sayan::unbounded_cursor_type<Iterator>
+            operator()(Iterator first) const
+            {
+                return ::sayan::unbounded_cursor_type<Iterator>(std::move(first));
+            }
+        };
+    }
+    // namespace details
+    /// @endcond
+
+    namespace
+    {
+        /// @brief Функциональный объект для создания неограниченного курсора
+        constexpr auto const & unbounded_cursor = static_const<details::unbounded_cursor_fn>;
+    }
+}
+// namespace v1
+}
+// namespace sayan
+
+#endif
+// Z_SAYAN_CURSOR_UNBOUNDED_HPP_INCLUDED
@@ -0,0 +1,335 @@
+#ifndef Z_SAYAN_CURSOR_ZIP_HPP_INCLUDED
+#define Z_SAYAN_CURSOR_ZIP_HPP_INCLUDED
+
+/** @file sayan/cursor/zip.hpp
+ @brief Курсор, синхронно проходящий несколько последовательностей
+ @details Позволяет применять алгоритмы к данным, хранящимся по столбцам
+ (каждое поле записи в отдельной последовательности), не собирая записи в
+ одну последовательность кортежей. Разыменование курсора возвращает
+ прокси-объект, ссылающийся на элементы всех последовательностей, поэтому
+ перестановки (@c sort, @c stable_partition, @c rotate, @c unique и т.д.)
+ выполняются одновременно во всех столбцах.
+*/
+
+#include <sayan/cursor/defs.hpp>
+#include <sayan/cursor/sequence_to_cursor.hpp>
+#include <sayan/utility/static_const.hpp>
+
+#include <algorithm>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace sayan
+{
+inline namespace v1
+{
+    /// @cond false
+    namespace details
+    {
+        // Вычисляет выражение для каждого элемента пакета по порядку
+        using swallow = int[];
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Прокси-ссылка на элементы нескольких последовательностей
+    @tparam References типы ссылок на элементы последовательностей
+    @details Является кортежем ссылок, поэтому к ней применимы @c std::get и
+    операторы сравнения кортежей. В отличие от @c std::tuple, присваивание
+    одной прокси-ссылки другой всегда копирует значения элементов, даже если
+    источник -- временный объект: разыменование курсора возвращает временный
+    объект, ссылающийся на элементы последовательностей, которые нельзя
+    портить. Значения перемещаются только из кортежа rvalue-ссылок (его
+    возвращает @c cursor_move) или из временного кортежа значений. Функция
+    @c swap принимает временные объекты, что позволяет переставлять элементы
+    с помощью @c cursor_swap.
+    */
+    template <class... References>
+    class zip_reference
+     : public std::tuple<References...>
+    {
+        using Base = std::tuple<References...>;
+
+        template <std::size_t... Is>
+        static void swap_impl(Base & x, Base & y, std::index_sequence<Is...>)
+        {
+            using std::swap;
+            (void)details::swallow{0, (swap(std::get<Is>(x), std::get<Is>(y)), 0)...};
+        }
+
+        friend void swap(zip_reference x, zip_reference y)
+        {
+            zip_reference::swap_impl(x, y, std::index_sequence_for<References...>{});
+        }
+
+    public:
+        // Создание, копирование, уничтожение
+        explicit zip_reference(References... refs)
+         : Base(std::forward<References>(refs)...)
+        {}
+
+        zip_reference(zip_reference const &) = default;
+        zip_reference(zip_reference &&) = default;
+
+        /** @brief Присваивание значений элементов, на которые ссылается @c x
+        @post Значения элементов, на которые ссылается @c *this, равны
+        значениям элементов, на которые ссылается @c x
+        */
+        zip_reference & operator=(zip_reference const & x)
+        {
+            Base::operator=(static_cast<Base const &>(x));
+            return *this;
+        }
+
+        /** @brief Присваивание значений из кортежа
+        @details Значения перемещаются только из тех элементов временного
+        кортежа, которые не являются lvalue-ссылками.
+        */
+        template <class... Types>
+        zip_reference & operator=(std::tuple<Types...> const & values)
+        {
+            Base::operator=(values);
+            return *this;
+        }
+
+        template <class... Types>
+        zip_reference & operator=(std::tuple<Types...> && values)
+        {
+            Base::operator=(std::move(values));
+            return *this;
+        }
+    };
+
+    /** @brief Курсор, синхронно проходящий несколько последовательностей
+    @tparam Cursors типы курсоров, проходящих последовательности
+    @details Курсор исчерпан, когда исчерпан хотя бы один из базовых курсоров.
+    Операции с задним концом последовательности предполагают, что базовые
+    курсоры имеют одинаковую длину.
+    */
+    template <class... Cursors>
+    class zip_cursor_type
+    {
+        static_assert(sizeof...(Cursors) > 0, "At least one cursor required");
+
+        using Indices = std::index_sequence_for<Cursors...>;
+
+        friend zip_cursor_type cursor_hook(zip_cursor_type cur, adl_tag)
+        {
+            cur.forget(::sayan::front_fn{});
+
+            return cur;
+        }
+
+    public:
+        // Типы
+        using reference = zip_reference<typename Cursors::reference...>;
+        using rvalue_reference = zip_reference<cursor_rvalue_reference_t<Cursors>...>;
+        using value_type = std::tuple<std::decay_t<typename Cursors::reference>...>;
+        using difference_type = std::common_type_t<difference_type_t<Cursors>...>;
+
+        // Создание
+        /** @brief Конструктор
+        @param curs базовые курсоры
+        */
+        explicit zip_cursor_type(Cursors... curs)
+         : bases_(std::move(curs)...)
+        {}
+
+        // Однопроходный курсор
+        bool empty() const
+        {
+            return this->empty_impl(Indices{});
+        }
+
+        reference operator[](::sayan::front_fn) const
+        {
+            return this->deref(::sayan::front_fn{}, Indices{});
+        }
+
+        void drop(::sayan::front_fn)
+        {
+            this->for_each_base([](auto & cur) { cur.drop(::sayan::front_fn{}); });
+        }
+
+        // Прямой курсор
+        zip_cursor_type traversed(::sayan::front_fn) const
+        {
+            return this->traversed_impl(::sayan::front_fn{}, Indices{});
+        }
+
+        void forget(::sayan::front_fn)
+        {
+            this->for_each_base([](auto & cur) { cur.forget(::sayan::front_fn{}); });
+        }
+
+        /** @brief Исчерпание курсора
+        @details Базовые курсоры продвигаются на одно и то же количество
+        элементов, поэтому остаются согласованными, даже если их длины
+        различаются.
+        */
+        void exhaust(::sayan::front_fn)
+        {
+            this->exhaust_impl(is_sized_cursor<zip_cursor_type>{});
+        }
+
+        void splice(zip_cursor_type other)
+        {
+            this->splice_impl(other, Indices{});
+        }
+
+        // Двунаправленный курсор
+        reference operator[](::sayan::back_fn) const
+        {
+            return this->deref(::sayan::back_fn{}, Indices{});
+        }
+
+        void drop(::sayan::back_fn)
+        {
+            this->for_each_base([](auto & cur) { cur.drop(::sayan::back_fn{}); });
+        }
+
+        zip_cursor_type traversed(::sayan::back_fn) const
+        {
+            return this->traversed_impl(::sayan::back_fn{}, Indices{});
+        }
+
+        // Курсор произвольного доступа
+        void drop(::sayan::front_fn, difference_type n)
+        {
+            this->for_each_base([n](auto & cur) { cur.drop(::sayan::front_fn{}, n); });
+        }
+
+        reference operator[](difference_type index) const
+        {
+            return this->deref(index, Indices{});
+        }
+
+        difference_type size() const
+        {
+            return this->size_impl(Indices{});
+        }
+
+        // Адаптор курсора
+        std::tuple<Cursors...> const & bases() const
+        {
+            return this->bases_;
+        }
+
+    private:
+        friend rvalue_reference cursor_move_hook(zip_cursor_type const & cur, adl_tag)
+        {
+            return cur.move_front(Indices{});
+        }
+
+        template <std::size_t... Is>
+        rvalue_reference move_front(std::index_sequence<Is...>) const
+        {
+            return rvalue_reference(::sayan::cursor_move(std::get<Is>(this->bases_))...);
+        }
+
+        template <class F>
+        void for_each_base(F f)
+        {
+            this->for_each_base_impl(f, Indices{});
+        }
+
+        template <class F, std::size_t... Is>
+        void for_each_base_impl(F & f, std::index_sequence<Is...>)
+        {
+            (void)details::swallow{0, (f(std::get<Is>(this->bases_)), 0)...};
+        }
+
+        template <std::size_t... Is>
+        bool empty_impl(std::index_sequence<Is...>) const
+        {
+            bool const es[] = {std::get<Is>(this->bases_).empty()...};
+
+            for(auto e : es)
+            {
+                if(e)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        template <class Position, std::size_t... Is>
+        reference deref(Position pos, std::index_sequence<Is...>) const
+        {
+            return reference(std::get<Is>(this->bases_)[pos]...);
+        }
+
+        template <class Direction, std::size_t... Is>
+        zip_cursor_type traversed_impl(Direction dir, std::index_sequence<Is...>) const
+        {
+            return zip_cursor_type(std::get<Is>(this->bases_).traversed(dir)...);
+        }
+
+        template <std::size_t... Is>
+        void splice_impl(zip_cursor_type & other, std::index_sequence<Is...>)
+        {
+            (void)details::swallow{0, (std::get<Is>(this->bases_)
+                                         .splice(std::move(std::get<Is>(other.bases_))), 0)...};
+        }
+
+        template <std::size_t... Is>
+        difference_type size_impl(std::index_sequence<Is...>) const
+        {
+            return std::min({static_cast<difference_type>(std::get<Is>(this->bases_).size())...});
+        }
+
+        void exhaust_impl(std::true_type)
+        {
+            this->drop(::sayan::front_fn{}, this->size());
+        }
+
+        void exhaust_impl(std::false_type)
+        {
+            for(; !this->empty(); this->drop(::sayan::front_fn{}))
+            {}
+        }
+
+    private:
+        std::tuple<Cursors...> bases_;
+    };
+
+    template <class... Cursors>
+    struct is_sized_cursor<zip_cursor_type<Cursors...>>
+     : std::integral_constant<bool, std::is_same<std::integer_sequence<bool, true, is_sized_cursor<Cursors>::value...>,
+                                                 std::integer_sequence<bool, is_sized_cursor<Cursors>::value..., true>>::value>
+    {};
+
+    /// @cond false
+    namespace details
+    {
+        struct zip_cursor_fn
+        {
+            template <class... Sequences>
+            ::sayan::zip_cursor_type<cursor_type_t<Sequences>...>
+            operator()(Sequences && ... seqs) const
+            {
+                using Result = ::sayan::zip_cursor_type<cursor_type_t<Sequences>...>;
+                return Result(::sayan::cursor_fwd<Sequences>(seqs)...);
+            }
+        };
+    }
+    // namespace details
+    /// @endcond
+
+    namespace
+    {
+        /** @brief Функциональный объект для создания курсора, синхронно
+        проходящего несколько последовательностей
+        */
+        constexpr auto const & zip_cursor = static_const<details::zip_cursor_fn>;
+    }
+}
+// namespace v1
+}
+// namespace sayan
+
+#endif
+// Z_SAYAN_CURSOR_ZIP_HPP_INCLUDED
@@ -3,47 +3,984 @@
 
 #include <sayan/utility/static_const.hpp>
 #include <sayan/cursor/sequence_to_cursor.hpp>
+#include <sayan/cursor/layout.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__FMA__)
+#include <immintrin.h>
+#endif
 
 namespace sayan
 {
 inline namespace v1
 {
+    struct accumulate_fn
+    {
+    public:
+        template <class InputSequence, class T, class BinaryOperation = std::plus<>>
+        T
+        operator()(InputSequence && in, T init_value, BinaryOperation op = BinaryOperation{}) const
+        {
+            auto in_cur = ::sayan::cursor_fwd<InputSequence>(in);
+
+            return this->impl(std::move(in_cur), std::move(init_value), op,
+                              cursor_layout_t<decltype(in_cur)>{});
+        }
+
+    private:
+        template <class InputCursor, class T, class BinaryOperation>
+        T impl(InputCursor in_cur, T init_value, BinaryOperation & op, generic_layout_tag) const
+        {
+            for(; !!in_cur; ++ in_cur)
+            {
+                init_value = op(init_value, *in_cur);
+            }
+
+            return init_value;
+        }
+
+        template <class SegmentedCursor, class T, class BinaryOperation>
+        T impl(SegmentedCursor in_cur, T init_value, BinaryOperation & op, segmented_layout_tag) const
+        {
+            for(auto s = ::sayan::segments(in_cur); !!s; ++ s)
+            {
+                auto seg = *s;
+                init_value = this->impl(std::move(seg), std::move(init_value), op,
+                                        cursor_layout_t<decltype(seg)>{});
+            }
+
+            return init_value;
+        }
+    };
+
+    /// @cond false
+    namespace details
+    {
+        /* Операции, для которых reduce может менять порядок вычислений.
+        Для целых чисел результат не зависит от порядка, для чисел с плавающей
+        точкой порядок описан в reduce_fn.
+        */
+        template <class T, class BinaryOperation>
+        struct is_reassociable_operation
+         : std::false_type
+        {};
+
+        template <class T>
+        struct is_reassociable_arithmetic
+         : std::integral_constant<bool, std::is_arithmetic<T>::value
+                                        && !std::is_same<T, bool>::value>
+        {};
+
+        /* Тип, в котором выполняются целочисленные вычисления с изменённым
+        порядком: промежуточные результаты, которых нет в последовательном
+        алгоритме, могут выйти за пределы знакового типа, а беззнаковая
+        арифметика определена по модулю и даёт тот же итоговый результат
+        */
+        template <class T, bool = std::is_integral<T>::value>
+        struct reassociation_type
+        {
+            using type = T;
+        };
+
+        template <class T>
+        struct reassociation_type<T, true>
+        {
+            using type = std::common_type_t<std::make_unsigned_t<T>, unsigned>;
+        };
+
+        template <class T>
+        using reassociation_type_t = typename reassociation_type<T>::type;
+
+        template <class T>
+        struct is_reassociable_operation<T, std::plus<>>
+         : is_reassociable_arithmetic<T>
+        {};
+
+        template <class T>
+        struct is_reassociable_operation<T, std::multiplies<>>
+         : is_reassociable_arithmetic<T>
+        {};
+
+        template <class T>
+        struct is_reassociable_operation<T, std::bit_and<>>
+         : std::integral_constant<bool, is_reassociable_arithmetic<T>::value && std::is_integral<T>::value>
+        {};
+
+        template <class T>
+        struct is_reassociable_operation<T, std::bit_or<>>
+         : std::integral_constant<bool, is_reassociable_arithmetic<T>::value && std::is_integral<T>::value>
+        {};
+
+        template <class T>
+        struct is_reassociable_operation<T, std::bit_xor<>>
+         : std::integral_constant<bool, is_reassociable_arithmetic<T>::value && std::is_integral<T>::value>
+        {};
+
+        template <class U, class T, class BinaryOperation>
+        struct is_reassociable_reduction
+         : std::integral_constant<bool, std::is_same<std::remove_cv_t<U>, T>::value
+                                        && !std::is_volatile<U>::value
+                                        && is_reassociable_operation<T, BinaryOperation>::value>
+        {};
+
+        // Объединение блоков по 16 байт
+        template <class T, class BinaryOperation,
+                  bool = std::is_floating_point<T>::value, std::size_t = sizeof(T)>
+        struct simd_reduction
+         : std::false_type
+        {};
+
+#if defined(__SSE2__)
+        template <class T>
+        struct simd_reduction<T, std::plus<>, false, 1>
+         : std::true_type
+        {
+            static __m128i combine(__m128i x, __m128i y)
+            {
+                return _mm_add_epi8(x, y);
+            }
+        };
+
+        template <class T>
+        struct simd_reduction<T, std::plus<>, false, 2>
+         : std::true_type
+        {
+            static __m128i combine(__m128i x, __m128i y)
+            {
+                return _mm_add_epi16(x, y);
+            }
+        };
+
+        template <class T>
+        struct simd_reduction<T, std::plus<>, false, 4>
+         : std::true_type
+        {
+            static __m128i combine(__m128i x, __m128i y)
+            {
+                return _mm_add_epi32(x, y);
+            }
+        };
+
+        template <class T>
+        struct simd_reduction<T, std::plus<>, false, 8>
+         : std::true_type
+        {
+            static __m128i combine(__m128i x, __m128i y)
+            {
+                return _mm_add_epi64(x, y);
+            }
+        };
+
+        template <class T>
+        struct simd_reduction<T, std::plus<>, true, 4>
+         : std::true_type
+        {
+            static __m128i combine(__m128i x, __m128i y)
+            {
+                return _mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(x), _mm_castsi128_ps(y)));
+            }
+        };
+
+        template <class T>
+        struct simd_reduction<T, std::plus<>, true, 8>
+         : std::true_type
+        {
+            static __m128i combine(__m128i x, __m128i y)
+            {
+                return _mm_castpd_si128(_mm_add_pd(_mm_castsi128_pd(x), _mm_castsi128_pd(y)));
+            }
+        };
+
+        template <class T>
+        struct simd_reduction<T, std::multiplies<>, true, 4>
+         : std::true_type
+        {
+            static __m128i combine(__m128i x, __m128i y)
+            {
+                return _mm_castps_si128(_mm_mul_ps(_mm_castsi128_ps(x), _mm_castsi128_ps(y)));
+            }
+        };
+
+        template <class T>
+        struct simd_reduction<T, std::multiplies<>, true, 8>
+         : std::true_type
+        {
+            static __m128i combine(__m128i x, __m128i y)
+            {
+                return _mm_castpd_si128(_mm_mul_pd(_mm_castsi128_pd(x), _mm_castsi128_pd(y)));
+            }
+        };
+
+        template <class T, std::size_t Size>
+        struct simd_reduction<T, std::bit_and<>, false, Size>
+         : std::true_type
+        {
+            static __m128i combine(__m128i x, __m128i y)
+            {
+                return _mm_and_si128(x, y);
+            }
+        };
+
+        template <class T, std::size_t Size>
+        struct simd_reduction<T, std::bit_or<>, false, Size>
+         : std::true_type
+        {
+            static __m128i combine(__m128i x, __m128i y)
+            {
+                return _mm_or_si128(x, y);
+            }
+        };
+
+        template <class T, std::size_t Size>
+        struct simd_reduction<T, std::bit_xor<>, false, Size>
+         : std::true_type
+        {
+            static __m128i combine(__m128i x, __m128i y)
+            {
+                return _mm_xor_si128(x, y);
+            }
+        };
+#endif
+
+        template <class T, class BinaryOperation>
+        struct has_simd_reduction
+         : std::integral_constant<bool, simd_reduction<T, BinaryOperation>::value
+                                        && 16 % sizeof(T) == 0>
+        {};
+
+        template <class U, class T, class BinaryOperation>
+        T reduce_sequential(U * first, U * last, T init_value, BinaryOperation & op)
+        {
+            for(; first != last; ++ first)
+            {
+                init_value = op(std::move(init_value), *first);
+            }
+
+            return init_value;
+        }
+
+        /* Четыре независимые частичные суммы: элемент с номером i попадает в
+        сумму i % 4, суммы объединяются как (s0 op s1) op (s2 op s3), затем
+        к начальному значению применяется результат и остаток
+        последовательности по порядку. Частичные суммы целых чисел
+        вычисляются в беззнаковом типе.
+        */
+        template <class U, class T, class BinaryOperation>
+        T reduce_reassociated(U * first, U * last, T init_value, BinaryOperation & op,
+                              std::false_type)
+        {
+            if(last - first < 4)
+            {
+                return details::reduce_sequential(first, last, std::move(init_value), op);
+            }
+
+            using A = reassociation_type_t<T>;
+
+            A s0 = A(first[0]);
+            A s1 = A(first[1]);
+            A s2 = A(first[2]);
+            A s3 = A(first[3]);
+            first += 4;
+
+            for(; last - first >= 4; first += 4)
+            {
+                s0 = op(s0, A(first[0]));
+                s1 = op(s1, A(first[1]));
+                s2 = op(s2, A(first[2]));
+                s3 = op(s3, A(first[3]));
+            }
+
+            init_value = static_cast<T>(op(A(init_value), op(op(s0, s1), op(s2, s3))));
+
+            return details::reduce_sequential(first, last, std::move(init_value), op);
+        }
+
+#if defined(__SSE2__)
+        /* Четыре блока по 16 байт: элемент с номером i попадает в частичную
+        сумму i % (4 * L), где L -- число элементов в блоке. Блоки объединяются
+        как (b0 op b1) op (b2 op b3), затем к начальному значению по порядку
+        применяются элементы полученного блока и остаток последовательности.
+        */
+        template <class U, class T, class BinaryOperation>
+        T reduce_reassociated(U * first, U * last, T init_value, BinaryOperation & op,
+                              std::true_type)
+        {
+            using Reduction = simd_reduction<T, BinaryOperation>;
+
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(T));
+
+            if(last - first < 4 * lanes)
+            {
+                return details::reduce_sequential(first, last, std::move(init_value), op);
+            }
+
+            auto const load = [](U * p)
+            {
+                return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+            };
+
+            auto b0 = load(first);
+            auto b1 = load(first + lanes);
+            auto b2 = load(first + 2 * lanes);
+            auto b3 = load(first + 3 * lanes);
+            first += 4 * lanes;
+
+            for(; last - first >= 4 * lanes; first += 4 * lanes)
+            {
+                b0 = Reduction::combine(b0, load(first));
+                b1 = Reduction::combine(b1, load(first + lanes));
+                b2 = Reduction::combine(b2, load(first + 2 * lanes));
+                b3 = Reduction::combine(b3, load(first + 3 * lanes));
+            }
+
+            alignas(16) T partial[lanes];
+            _mm_store_si128(reinterpret_cast<__m128i *>(partial),
+                            Reduction::combine(Reduction::combine(b0, b1),
+                                               Reduction::combine(b2, b3)));
+
+            using A = reassociation_type_t<T>;
+
+            auto total = A(init_value);
+
+            for(auto const & p : partial)
+            {
+                total = op(total, A(p));
+            }
+
+            init_value = static_cast<T>(total);
+
+            return details::reduce_sequential(first, last, std::move(init_value), op);
+        }
+#endif
+    }
+    // namespace details
+    /// @endcond
+
+    /// @cond false
+    namespace details
+    {
+        // Шаг iota без явно заданного шага: значение увеличивается с помощью ++
+        struct unit_step
+        {};
+
+        template <class Step>
+        struct iota_step_type
+        {
+            using type = Step;
+        };
+
+        template <>
+        struct iota_step_type<unit_step>
+        {
+            using type = int;
+        };
+
+        /* Элементы блока вычисляются независимо сложением по модулю 2^N в типе
+        элементов. Результат совпадает с последовательным увеличением значения,
+        если тип значения не уже типа элементов, или если сложение выполняется
+        в знаковом типе того же размера, что и значение: тогда переполнение
+        недопустимо, и значения точны.
+        */
+        template <class U, class T, class Step,
+                  class StepValue = typename iota_step_type<Step>::type,
+                  bool = std::is_integral<T>::value && std::is_integral<StepValue>::value>
+        struct is_simd_iota_compatible
+         : std::false_type
+        {};
+
+        template <class U, class T, class StepValue,
+                  class Sum = decltype(std::declval<T>() + std::declval<StepValue>())>
+        struct is_iota_lane_exact
+         : std::integral_constant<bool, sizeof(U) <= sizeof(T)
+                                        || (std::is_signed<Sum>::value
+                                            && sizeof(Sum) == sizeof(T))>
+        {};
+
+        template <class U, class T, class Step, class StepValue>
+        struct is_simd_iota_compatible<U, T, Step, StepValue, true>
+         : std::integral_constant<bool, !std::is_const<U>::value
+                                        && !std::is_volatile<U>::value
+                                        && std::is_integral<U>::value
+                                        && !std::is_same<std::remove_cv_t<U>, bool>::value
+                                        && !std::is_same<T, bool>::value
+                                        && !std::is_same<StepValue, bool>::value
+                                        && is_iota_lane_exact<U, T, StepValue>::value
+                                        && has_simd_reduction<std::remove_cv_t<U>,
+                                                              std::plus<>>::value>
+        {};
+
+        template <class OutputCursor, class T, class Step,
+                  bool = ::sayan::is_contiguous_cursor<OutputCursor>::value>
+        struct use_iota_kernel
+         : std::false_type
+        {};
+
+        template <class OutputCursor, class T, class Step>
+        struct use_iota_kernel<OutputCursor, T, Step, true>
+         : is_simd_iota_compatible<std::remove_pointer_t<::sayan::contiguous_pointer_t<OutputCursor>>,
+                                   T, Step>
+        {};
+
+        template <class U, class Step>
+        U iota_step_value(Step const & step)
+        {
+            return static_cast<U>(step);
+        }
+
+        template <class U>
+        U iota_step_value(unit_step)
+        {
+            return U(1);
+        }
+
+#if defined(__SSE2__)
+        /* Блок содержит L последовательных значений, следующий блок получается
+        прибавлением L шагов ко всем элементам. Вычисления ведутся в
+        беззнаковом типе, чтобы переполнение не было неопределённым.
+        */
+        template <class U>
+        void iota_blocks(U * out, std::ptrdiff_t n, U value, U step)
+        {
+            using Unsigned = std::make_unsigned_t<U>;
+            using Addition = simd_reduction<U, std::plus<>>;
+
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(U));
+
+            alignas(16) U block[lanes];
+
+            auto current = static_cast<Unsigned>(value);
+            for(auto & x : block)
+            {
+                x = static_cast<U>(current);
+                current = static_cast<Unsigned>(current + static_cast<Unsigned>(step));
+            }
+
+            auto x = _mm_load_si128(reinterpret_cast<__m128i const *>(block));
+
+            for(auto & y : block)
+            {
+                y = static_cast<U>(current - static_cast<Unsigned>(value));
+            }
+            auto const increment = _mm_load_si128(reinterpret_cast<__m128i const *>(block));
+
+            for(; n >= lanes; n -= lanes, out += lanes)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out), x);
+                x = Addition::combine(x, increment);
+            }
+
+            _mm_store_si128(reinterpret_cast<__m128i *>(block), x);
+            std::copy(block, block + n, out);
+        }
+#endif
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Заполнение последовательности возрастающими значениями
+    @details Первый вариант записывает value, ++value и т.д., второй --
+    value, value += step и т.д. Если выходная последовательность непрерывна,
+    а её элементы, значение и шаг -- целые числа, то значения вычисляются
+    блоками по 16 байт с помощью SSE2. Для значений, тип которых уже типа
+    элементов, это делается, только если приращение выполняется в знаковом
+    типе, так как иначе значение переполнялось бы раньше элементов.
+    */
     struct iota_fn
     {
+    public:
         template <class OutputSequence, class Incrementable>
         sayan::safe_cursor_type_t<OutputSequence>
         operator()(OutputSequence && out, Incrementable value) const
         {
             auto out_cur = ::sayan::cursor_fwd<OutputSequence>(out);
 
-            for(; !!out_cur; ++ value)
+            using Kernel = details::use_iota_kernel<decltype(out_cur), Incrementable,
+                                                    details::unit_step>;
+
+            return this->impl(std::move(out_cur), std::move(value), details::unit_step{},
+                              Kernel{});
+        }
+
+        template <class OutputSequence, class T, class Step>
+        sayan::safe_cursor_type_t<OutputSequence>
+        operator()(OutputSequence && out, T value, Step step) const
+        {
+            auto out_cur = ::sayan::cursor_fwd<OutputSequence>(out);
+
+            using Kernel = details::use_iota_kernel<decltype(out_cur), T, Step>;
+
+            return this->impl(std::move(out_cur), std::move(value), step, Kernel{});
+        }
+
+    private:
+        template <class OutputCursor, class Incrementable>
+        OutputCursor impl(OutputCursor out_cur, Incrementable value, details::unit_step,
+                          std::false_type) const
+        {
+            for(; !!out_cur; ++ value)
+            {
+                out_cur << value;
+            }
+
+            return out_cur;
+        }
+
+        template <class OutputCursor, class T, class Step>
+        OutputCursor impl(OutputCursor out_cur, T value, Step const & step, std::false_type) const
+        {
+            for(; !!out_cur; value += step)
+            {
+                out_cur << value;
+            }
+
+            return out_cur;
+        }
+
+#if defined(__SSE2__)
+        template <class OutputCursor, class T, class Step>
+        OutputCursor impl(OutputCursor out_cur, T value, Step const & step, std::true_type) const
+        {
+            using Element = std::remove_pointer_t<::sayan::contiguous_pointer_t<OutputCursor>>;
+
+            auto const n = out_cur.size();
+
+            details::iota_blocks(::sayan::cursor_data(out_cur), n, static_cast<Element>(value),
+                                 details::iota_step_value<Element>(step));
+
+            out_cur += n;
+            return out_cur;
+        }
+#endif
+    };
+
+    /** @brief Свёртка последовательности, допускающая изменение порядка
+    применения операции
+    @details В отличие от accumulate, элементы могут объединяться в любом
+    порядке, что позволяет использовать несколько независимых частичных сумм
+    и векторные инструкции. Для непрерывных последовательностей, тип
+    элементов которых совпадает с типом начального значения, это делается
+    для арифметических типов и операций std::plus<>, std::multiplies<>, а
+    для целых типов также std::bit_and<>, std::bit_or<> и std::bit_xor<>.
+    Для целых типов результат совпадает с результатом accumulate. Для чисел
+    с плавающей точкой порядок фиксирован и зависит только от типа и длины
+    последовательности: элемент с номером i попадает в частичную сумму
+    i % K, где K равно 4 * (16 / sizeof(T)), если для операции есть
+    реализация на SSE2, и 4 в остальных случаях. Частичные суммы
+    объединяются попарно, после чего к начальному значению по порядку
+    применяются результат и оставшиеся элементы, не вошедшие в полные группы
+    по K элементов. Последовательности короче K, а также остальные
+    последовательности и операции сворачиваются по порядку, как в accumulate.
+    Элементы, проходимые курсором с постоянным шагом, копируются в локальный
+    буфер блоками по 256 элементов, каждый блок сворачивается так же, как
+    непрерывная последовательность, и его результат служит начальным
+    значением для следующего блока.
+    */
+    struct reduce_fn
+    {
+    public:
+        template <class InputSequence, class T, class BinaryOperation = std::plus<>>
+        T
+        operator()(InputSequence && in, T init_value, BinaryOperation op = BinaryOperation{}) const
+        {
+            auto in_cur = ::sayan::cursor_fwd<InputSequence>(in);
+
+            return this->impl(std::move(in_cur), std::move(init_value), op,
+                              cursor_layout_t<decltype(in_cur)>{});
+        }
+
+    private:
+        template <class InputCursor, class T, class BinaryOperation>
+        T impl(InputCursor in_cur, T init_value, BinaryOperation & op, generic_layout_tag) const
+        {
+            return ::sayan::accumulate_fn{}(std::move(in_cur), std::move(init_value), op);
+        }
+
+        template <class ContiguousCursor, class T, class BinaryOperation>
+        T impl(ContiguousCursor in_cur, T init_value, BinaryOperation & op,
+               contiguous_layout_tag) const
+        {
+            auto const first = ::sayan::cursor_data(in_cur);
+            auto const last = first + in_cur.size();
+
+            using U = std::remove_pointer_t<decltype(first)>;
+
+            return this->impl_contiguous(first, last, std::move(init_value), op,
+                                         details::is_reassociable_reduction<U, T, BinaryOperation>{});
+        }
+
+        template <class U, class T, class BinaryOperation>
+        T impl_contiguous(U * first, U * last, T init_value, BinaryOperation & op,
+                          std::false_type) const
+        {
+            return details::reduce_sequential(first, last, std::move(init_value), op);
+        }
+
+        template <class U, class T, class BinaryOperation>
+        T impl_contiguous(U * first, U * last, T init_value, BinaryOperation & op,
+                          std::true_type) const
+        {
+            return details::reduce_reassociated(first, last, std::move(init_value), op,
+                                                details::has_simd_reduction<T, BinaryOperation>{});
+        }
+
+        template <class StridedCursor, class T, class BinaryOperation>
+        T impl(StridedCursor in_cur, T init_value, BinaryOperation & op, strided_layout_tag) const
+        {
+            using U = std::remove_pointer_t<decltype(in_cur.data())>;
+
+            return this->impl_strided(std::move(in_cur), std::move(init_value), op,
+                                      details::is_reassociable_reduction<U, T, BinaryOperation>{});
+        }
+
+        template <class StridedCursor, class T, class BinaryOperation>
+        T impl_strided(StridedCursor in_cur, T init_value, BinaryOperation & op,
+                       std::false_type) const
+        {
+            return ::sayan::accumulate_fn{}(std::move(in_cur), std::move(init_value), op);
+        }
+
+        template <class StridedCursor, class T, class BinaryOperation>
+        T impl_strided(StridedCursor in_cur, T init_value, BinaryOperation & op,
+                       std::true_type) const
+        {
+            auto const n = in_cur.size();
+
+            if(n == 0)
+            {
+                return init_value;
+            }
+
+            using U = std::remove_pointer_t<decltype(in_cur.data())>;
+            using Gather = details::strided_gather<U>;
+
+            Gather gather(in_cur.data(), in_cur.stride());
+
+            for(std::ptrdiff_t offset = 0; offset < n; offset += Gather::block_size)
+            {
+                auto const m = std::min(n - offset, Gather::block_size);
+                auto const first = gather.block(offset, m);
+
+                init_value = details::reduce_reassociated(first, first + m, std::move(init_value), op,
+                                                          details::has_simd_reduction<T, BinaryOperation>{});
+            }
+
+            return init_value;
+        }
+
+        template <class SegmentedCursor, class T, class BinaryOperation>
+        T impl(SegmentedCursor in_cur, T init_value, BinaryOperation & op, segmented_layout_tag) const
+        {
+            for(auto s = ::sayan::segments(in_cur); !!s; ++ s)
+            {
+                init_value = (*this)(*s, std::move(init_value), op);
+            }
+
+            return init_value;
+        }
+    };
+
+    /// @cond false
+    namespace details
+    {
+        /* Скалярное произведение с операциями по умолчанию для непрерывных
+        последовательностей и последовательностей с постоянным шагом,
+        состоящих из арифметических значений того же типа, что и начальное
+        значение, вычисляется с несколькими частичными суммами
+        */
+        template <class U1, class U2, class T, class BinaryOperation1, class BinaryOperation2>
+        struct is_dot_product_compatible
+         : std::integral_constant<bool, std::is_same<BinaryOperation1, std::plus<>>::value
+                                        && std::is_same<BinaryOperation2, std::multiplies<>>::value
+                                        && std::is_same<std::remove_cv_t<U1>, T>::value
+                                        && std::is_same<std::remove_cv_t<U2>, T>::value
+                                        && !std::is_volatile<U1>::value
+                                        && !std::is_volatile<U2>::value
+                                        && is_reassociable_arithmetic<T>::value>
+        {};
+
+        // Последовательности с непрерывным размещением или с постоянным шагом
+        template <class Cursor>
+        struct is_dot_product_cursor
+         : std::integral_constant<bool, ::sayan::is_contiguous_cursor<Cursor>::value
+                                        || ::sayan::is_strided_cursor<Cursor>::value>
+        {};
+
+        template <class Cursor1, class Cursor2, class T, class BinaryOperation1, class BinaryOperation2,
+                  bool = is_dot_product_cursor<Cursor1>::value && is_dot_product_cursor<Cursor2>::value>
+        struct use_dot_product_kernel
+         : std::false_type
+        {};
+
+        template <class Cursor1, class Cursor2, class T, class BinaryOperation1, class BinaryOperation2>
+        struct use_dot_product_kernel<Cursor1, Cursor2, T, BinaryOperation1, BinaryOperation2, true>
+         : is_dot_product_compatible<std::remove_reference_t<typename Cursor1::reference>,
+                                     std::remove_reference_t<typename Cursor2::reference>,
+                                     T, BinaryOperation1, BinaryOperation2>
+        {};
+
+        struct dot_product_tag {};
+
+        template <class T>
+        struct simd_dot_product
+         : std::false_type
+        {};
+
+#if defined(__SSE2__)
+        template <>
+        struct simd_dot_product<float>
+         : std::true_type
+        {
+            using block_type = __m128;
+
+            static block_type zero()
+            {
+                return _mm_setzero_ps();
+            }
+
+            static block_type load(float const * p)
+            {
+                return _mm_loadu_ps(p);
+            }
+
+            static block_type add(block_type x, block_type y)
+            {
+                return _mm_add_ps(x, y);
+            }
+
+            // acc + x * y, с однократным округлением при наличии FMA
+            static block_type multiply_add(block_type x, block_type y, block_type acc)
+            {
+#if defined(__FMA__)
+                return _mm_fmadd_ps(x, y, acc);
+#else
+                return _mm_add_ps(acc, _mm_mul_ps(x, y));
+#endif
+            }
+
+            static void store(float * p, block_type x)
+            {
+                _mm_storeu_ps(p, x);
+            }
+        };
+
+        template <>
+        struct simd_dot_product<double>
+         : std::true_type
+        {
+            using block_type = __m128d;
+
+            static block_type zero()
+            {
+                return _mm_setzero_pd();
+            }
+
+            static block_type load(double const * p)
+            {
+                return _mm_loadu_pd(p);
+            }
+
+            static block_type add(block_type x, block_type y)
+            {
+                return _mm_add_pd(x, y);
+            }
+
+            static block_type multiply_add(block_type x, block_type y, block_type acc)
+            {
+#if defined(__FMA__)
+                return _mm_fmadd_pd(x, y, acc);
+#else
+                return _mm_add_pd(acc, _mm_mul_pd(x, y));
+#endif
+            }
+
+            static void store(double * p, block_type x)
+            {
+                _mm_storeu_pd(p, x);
+            }
+        };
+#endif
+
+        template <class U1, class U2, class T>
+        T dot_product_sequential(U1 * x, U2 * y, std::ptrdiff_t n, T init_value)
+        {
+            for(std::ptrdiff_t i = 0; i != n; ++ i)
+            {
+                init_value = init_value + x[i] * y[i];
+            }
+
+            return init_value;
+        }
+
+        /* Четыре частичные суммы: произведение с номером i прибавляется к
+        сумме i % 4, суммы объединяются как (s0 + s1) + (s2 + s3)
+        */
+        template <class U1, class U2, class T>
+        T dot_product(U1 * x, U2 * y, std::ptrdiff_t n, T init_value, std::false_type)
+        {
+            if(n < 4)
+            {
+                return details::dot_product_sequential(x, y, n, std::move(init_value));
+            }
+
+            using A = reassociation_type_t<T>;
+
+            A s0 = A(x[0]) * A(y[0]);
+            A s1 = A(x[1]) * A(y[1]);
+            A s2 = A(x[2]) * A(y[2]);
+            A s3 = A(x[3]) * A(y[3]);
+
+            std::ptrdiff_t i = 4;
+
+            for(; n - i >= 4; i += 4)
+            {
+                s0 = s0 + A(x[i]) * A(y[i]);
+                s1 = s1 + A(x[i + 1]) * A(y[i + 1]);
+                s2 = s2 + A(x[i + 2]) * A(y[i + 2]);
+                s3 = s3 + A(x[i + 3]) * A(y[i + 3]);
+            }
+
+            init_value = static_cast<T>(A(init_value) + ((s0 + s1) + (s2 + s3)));
+
+            return details::dot_product_sequential(x + i, y + i, n - i, std::move(init_value));
+        }
+
+#if defined(__SSE2__)
+        /* Четыре блока частичных сумм по 16 байт: произведение с номером i
+        прибавляется к сумме i % (4 * L), где L -- число элементов в блоке.
+        Блоки объединяются как (b0 + b1) + (b2 + b3), элементы полученного
+        блока и оставшиеся произведения прибавляются к начальному значению по
+        порядку.
+        */
+        template <class U1, class U2, class T>
+        T dot_product(U1 * x, U2 * y, std::ptrdiff_t n, T init_value, std::true_type)
+        {
+            using Kernel = simd_dot_product<T>;
+
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(T));
+
+            auto b0 = Kernel::zero();
+            auto b1 = Kernel::zero();
+            auto b2 = Kernel::zero();
+            auto b3 = Kernel::zero();
+
+            std::ptrdiff_t i = 0;
+
+            for(; n - i >= 4 * lanes; i += 4 * lanes)
             {
-                out_cur << value;
+                b0 = Kernel::multiply_add(Kernel::load(x + i), Kernel::load(y + i), b0);
+                b1 = Kernel::multiply_add(Kernel::load(x + i + lanes),
+                                          Kernel::load(y + i + lanes), b1);
+                b2 = Kernel::multiply_add(Kernel::load(x + i + 2 * lanes),
+                                          Kernel::load(y + i + 2 * lanes), b2);
+                b3 = Kernel::multiply_add(Kernel::load(x + i + 3 * lanes),
+                                          Kernel::load(y + i + 3 * lanes), b3);
             }
 
-            return out_cur;
+            if(i != 0)
+            {
+                T partial[lanes];
+                Kernel::store(partial, Kernel::add(Kernel::add(b0, b1), Kernel::add(b2, b3)));
+
+                for(auto const & p : partial)
+                {
+                    init_value = init_value + p;
+                }
+            }
+
+            return details::dot_product_sequential(x + i, y + i, n - i, std::move(init_value));
         }
-    };
+#endif
 
-    struct accumulate_fn
-    {
-        template <class InputSequence, class T, class BinaryOperation = std::plus<>>
-        T
-        operator()(InputSequence && in, T init_value, BinaryOperation op = BinaryOperation{}) const
+        // Указатель на первый элемент и шаг
+        template <class ContiguousCursor>
+        std::pair<::sayan::contiguous_pointer_t<ContiguousCursor>, std::ptrdiff_t>
+        strided_view(ContiguousCursor const & cur, contiguous_layout_tag)
         {
-            for(auto in_cur = ::sayan::cursor_fwd<InputSequence>(in); !!in_cur; ++ in_cur)
+            return {::sayan::cursor_data(cur), 1};
+        }
+
+        template <class StridedCursor>
+        std::pair<typename StridedCursor::pointer, std::ptrdiff_t>
+        strided_view(StridedCursor const & cur, strided_layout_tag)
+        {
+            return {cur.data(), cur.stride()};
+        }
+
+        template <class ContiguousCursor1, class ContiguousCursor2, class T, class Kernel>
+        T dot_product_cursors(ContiguousCursor1 const & in1_cur, ContiguousCursor2 const & in2_cur,
+                              T init_value, Kernel kernel,
+                              contiguous_layout_tag, contiguous_layout_tag)
+        {
+            auto const n = std::min<std::ptrdiff_t>(in1_cur.size(), in2_cur.size());
+
+            return details::dot_product(::sayan::cursor_data(in1_cur), ::sayan::cursor_data(in2_cur),
+                                        n, std::move(init_value), kernel);
+        }
+
+        /* Если хотя бы одна из последовательностей проходится с шагом,
+        произведение вычисляется блоками: элементы блока копируются в
+        локальные буферы, а результат блока служит начальным значением
+        для следующего
+        */
+        template <class Cursor1, class Cursor2, class T, class Kernel>
+        T dot_product_cursors(Cursor1 const & in1_cur, Cursor2 const & in2_cur,
+                              T init_value, Kernel kernel,
+                              generic_layout_tag, generic_layout_tag)
+        {
+            auto const n = std::min<std::ptrdiff_t>(in1_cur.size(), in2_cur.size());
+
+            if(n == 0)
             {
-                init_value = op(init_value, *in_cur);
+                return init_value;
+            }
+
+            auto const x = details::strided_view(in1_cur, cursor_layout_t<Cursor1>{});
+            auto const y = details::strided_view(in2_cur, cursor_layout_t<Cursor2>{});
+
+            using Gather1 = strided_gather<std::remove_pointer_t<decltype(x.first)>>;
+            using Gather2 = strided_gather<std::remove_pointer_t<decltype(y.first)>>;
+
+            Gather1 gather1(x.first, x.second);
+            Gather2 gather2(y.first, y.second);
+
+            for(std::ptrdiff_t offset = 0; offset < n; offset += Gather1::block_size)
+            {
+                auto const m = std::min(n - offset, Gather1::block_size);
+
+                init_value = details::dot_product(gather1.block(offset, m), gather2.block(offset, m),
+                                                  m, std::move(init_value), kernel);
             }
 
             return init_value;
         }
-    };
+    }
+    // namespace details
+    /// @endcond
 
+    /** @brief Обобщённое скалярное произведение
+    @details Вычисления выполняются строго слева направо, как в
+    std::inner_product, поэтому для чисел с плавающей точкой результат
+    побитово совпадает с последовательным алгоритмом. Если используются
+    операции по умолчанию (std::plus<> и std::multiplies<>), обе
+    последовательности непрерывны или проходятся с постоянным шагом, а типы
+    их элементов совпадают с целым типом начального значения, произведения
+    суммируются в четырёх независимых суммах по модулю 2^N: результат от
+    этого не меняется.
+    Если порядок суммирования не важен, следует использовать transform_reduce.
+    */
     struct inner_product_fn
     {
+    public:
         template <class InputSequence1, class InputSequence2, class T,
                   class BinaryOperation1 = std::plus<>, class BinaryOperation2 = std::multiplies<>>
         T
@@ -54,6 +991,35 @@ inline namespace v1
             auto in1_cur = ::sayan::cursor_fwd<InputSequence1>(in1);
             auto in2_cur = ::sayan::cursor_fwd<InputSequence2>(in2);
 
+            using Cursor1 = decltype(in1_cur);
+            using Cursor2 = decltype(in2_cur);
+            using Tag = std::conditional_t<details::use_dot_product_kernel<Cursor1, Cursor2, T,
+                                                                           BinaryOperation1,
+                                                                           BinaryOperation2>::value
+                                           && std::is_integral<T>::value,
+                                           details::dot_product_tag, std::false_type>;
+
+            return this->impl(std::move(in1_cur), std::move(in2_cur), std::move(init_value),
+                              op1, op2, Tag{});
+        }
+
+    private:
+        template <class Cursor1, class Cursor2, class T,
+                  class BinaryOperation1, class BinaryOperation2>
+        T impl(Cursor1 in1_cur, Cursor2 in2_cur, T init_value,
+               BinaryOperation1 &, BinaryOperation2 &, details::dot_product_tag) const
+        {
+            return details::dot_product_cursors(in1_cur, in2_cur, std::move(init_value),
+                                                std::false_type{},
+                                                cursor_layout_t<Cursor1>{},
+                                                cursor_layout_t<Cursor2>{});
+        }
+
+        template <class InputCursor1, class InputCursor2, class T,
+                  class BinaryOperation1, class BinaryOperation2>
+        T impl(InputCursor1 in1_cur, InputCursor2 in2_cur, T init_value,
+               BinaryOperation1 & op1, BinaryOperation2 & op2, std::false_type) const
+        {
             for(; !!in1_cur && !!in2_cur; ++ in1_cur, ++in2_cur)
             {
                 init_value = op1(init_value, op2(*in1_cur, *in2_cur));
@@ -63,8 +1029,256 @@ inline namespace v1
         }
     };
 
+    /** @brief Обобщённое скалярное произведение без фиксированного порядка вычислений
+    @details Аналог std::transform_reduce для двух последовательностей:
+    операция @c op1 должна быть ассоциативной и коммутативной, порядок её
+    применения не определён. Если используются операции по умолчанию, обе
+    последовательности непрерывны или проходятся с постоянным шагом, а типы
+    их элементов совпадают с арифметическим типом начального значения,
+    произведения суммируются в нескольких независимых суммах: для float и
+    double -- в четырёх блоках SSE2 (с FMA, если она доступна), для
+    остальных типов -- в четырёх скалярных суммах. Суммы объединяются
+    попарно и прибавляются к начальному значению, затем по порядку
+    прибавляются оставшиеся произведения. Если хотя бы одна из последовательностей проходится с
+    шагом, так обрабатывается каждый блок из 256 произведений, а результат
+    блока служит начальным значением для следующего. Для чисел с плавающей
+    точкой результат может отличаться от inner_product в последних разрядах.
+    */
+    struct transform_reduce_fn
+    {
+    public:
+        template <class InputSequence1, class InputSequence2, class T,
+                  class BinaryOperation1 = std::plus<>, class BinaryOperation2 = std::multiplies<>>
+        T
+        operator()(InputSequence1 && in1, InputSequence2 && in2, T init_value,
+                   BinaryOperation1 op1 = BinaryOperation1{},
+                   BinaryOperation2 op2 = BinaryOperation2{}) const
+        {
+            auto in1_cur = ::sayan::cursor_fwd<InputSequence1>(in1);
+            auto in2_cur = ::sayan::cursor_fwd<InputSequence2>(in2);
+
+            using Cursor1 = decltype(in1_cur);
+            using Cursor2 = decltype(in2_cur);
+            using Tag = std::conditional_t<details::use_dot_product_kernel<Cursor1, Cursor2, T,
+                                                                           BinaryOperation1,
+                                                                           BinaryOperation2>::value,
+                                           details::dot_product_tag, std::false_type>;
+
+            return this->impl(std::move(in1_cur), std::move(in2_cur), std::move(init_value),
+                              op1, op2, Tag{});
+        }
+
+    private:
+        template <class Cursor1, class Cursor2, class T,
+                  class BinaryOperation1, class BinaryOperation2>
+        T impl(Cursor1 in1_cur, Cursor2 in2_cur, T init_value,
+               BinaryOperation1 &, BinaryOperation2 &, details::dot_product_tag) const
+        {
+            return details::dot_product_cursors(in1_cur, in2_cur, std::move(init_value),
+                                                details::simd_dot_product<T>{},
+                                                cursor_layout_t<Cursor1>{},
+                                                cursor_layout_t<Cursor2>{});
+        }
+
+        template <class InputCursor1, class InputCursor2, class T,
+                  class BinaryOperation1, class BinaryOperation2>
+        T impl(InputCursor1 in1_cur, InputCursor2 in2_cur, T init_value,
+               BinaryOperation1 & op1, BinaryOperation2 & op2, std::false_type) const
+        {
+            return ::sayan::inner_product_fn{}(std::move(in1_cur), std::move(in2_cur),
+                                               std::move(init_value), op1, op2);
+        }
+    };
+
+    /// @cond false
+    namespace details
+    {
+        /* Блочное сканирование меняет порядок сложений, поэтому без явного
+        разрешения (Reorder) оно используется только для целых чисел
+        */
+        template <class U, class V, class BinaryOperation, bool Reorder>
+        struct is_simd_scan_compatible
+         : std::integral_constant<bool, std::is_same<BinaryOperation, std::plus<>>::value
+                                        && std::is_same<std::remove_cv_t<U>, V>::value
+                                        && !std::is_volatile<U>::value
+                                        && is_reassociable_arithmetic<V>::value
+                                        && (Reorder || std::is_integral<V>::value)
+                                        && has_simd_reduction<V, std::plus<>>::value>
+        {};
+
+        template <class InputCursor, class OutputCursor, class BinaryOperation, bool Reorder,
+                  bool = ::sayan::is_contiguous_cursor<InputCursor>::value
+                         && ::sayan::is_contiguous_cursor<OutputCursor>::value>
+        struct use_scan_kernel
+         : std::false_type
+        {};
+
+        template <class InputCursor, class OutputCursor, class BinaryOperation, bool Reorder>
+        struct use_scan_kernel<InputCursor, OutputCursor, BinaryOperation, Reorder, true>
+         : is_simd_scan_compatible<std::remove_pointer_t<::sayan::contiguous_pointer_t<InputCursor>>,
+                                   std::remove_pointer_t<::sayan::contiguous_pointer_t<OutputCursor>>,
+                                   BinaryOperation, Reorder>
+        {};
+
+        /* Запись результата блока не портит ещё не прочитанные элементы, если
+        выход начинается не позже входа или не пересекается с ним
+        */
+        template <class U, class V>
+        bool is_scan_overlap_safe(U * in, V * out, std::ptrdiff_t n)
+        {
+            auto const in_address = reinterpret_cast<std::uintptr_t>(in);
+            auto const out_address = reinterpret_cast<std::uintptr_t>(out);
+
+            return out_address <= in_address
+                   || out_address >= reinterpret_cast<std::uintptr_t>(in + n);
+        }
+
+#if defined(__SSE2__)
+        // Блок, все элементы которого равны -0.0
+        template <class T>
+        __m128i simd_negative_zeros()
+        {
+            return sizeof(T) == 4 ? _mm_castps_si128(_mm_set1_ps(-0.0f))
+                                  : _mm_castpd_si128(_mm_set1_pd(-0.0));
+        }
+
+        // Нейтральный элемент сложения: -0.0, в отличие от +0.0, не меняет слагаемое -0.0
+        template <class T>
+        __m128i simd_scan_identity(std::false_type)
+        {
+            return _mm_setzero_si128();
+        }
+
+        template <class T>
+        __m128i simd_scan_identity(std::true_type)
+        {
+            return details::simd_negative_zeros<T>();
+        }
+
+        // Сдвиг блока на Bytes байт в сторону старших элементов
+        template <class T, std::size_t Bytes>
+        __m128i simd_scan_shift(__m128i x, std::false_type)
+        {
+            return _mm_slli_si128(x, Bytes);
+        }
+
+        // Освободившиеся элементы заполняются нейтральным элементом
+        template <class T, std::size_t Bytes>
+        __m128i simd_scan_shift(__m128i x, std::true_type)
+        {
+            auto const vacated = _mm_andnot_si128(_mm_slli_si128(_mm_set1_epi32(-1), Bytes),
+                                                  details::simd_negative_zeros<T>());
+
+            return _mm_or_si128(_mm_slli_si128(x, Bytes), vacated);
+        }
+
+        template <class T, std::size_t Bytes>
+        __m128i simd_scan(__m128i x, std::false_type)
+        {
+            return x;
+        }
+
+        /* Сканирование за log2(L) шагов: на каждом шаге к элементу
+        прибавляется элемент, отстоящий от него на Bytes байт
+        */
+        template <class T, std::size_t Bytes>
+        __m128i simd_scan(__m128i x, std::true_type)
+        {
+            using Add = simd_reduction<T, std::plus<>>;
+
+            x = Add::combine(x, details::simd_scan_shift<T, Bytes>(x, std::is_floating_point<T>{}));
+
+            return details::simd_scan<T, 2 * Bytes>(x, std::integral_constant<bool, (2 * Bytes < 16)>{});
+        }
+
+        template <class T>
+        __m128i simd_scan(__m128i x)
+        {
+            return details::simd_scan<T, sizeof(T)>(x, std::true_type{});
+        }
+
+        // Блок, все элементы которого равны последнему элементу x
+        inline __m128i simd_broadcast_last(__m128i x, std::integral_constant<std::size_t, 1>)
+        {
+            auto y = _mm_srli_si128(x, 15);
+            y = _mm_unpacklo_epi8(y, y);
+            y = _mm_shufflelo_epi16(y, 0);
+            return _mm_shuffle_epi32(y, 0);
+        }
+
+        inline __m128i simd_broadcast_last(__m128i x, std::integral_constant<std::size_t, 2>)
+        {
+            return _mm_shuffle_epi32(_mm_shufflehi_epi16(x, 0xFF), 0xFF);
+        }
+
+        inline __m128i simd_broadcast_last(__m128i x, std::integral_constant<std::size_t, 4>)
+        {
+            return _mm_shuffle_epi32(x, 0xFF);
+        }
+
+        inline __m128i simd_broadcast_last(__m128i x, std::integral_constant<std::size_t, 8>)
+        {
+            return _mm_shuffle_epi32(x, 0xEE);
+        }
+
+        /* Частичные суммы блока вычисляются сканированием, к ним прибавляется
+        последняя сумма предыдущего блока. Для чисел с плавающей точкой это
+        меняет порядок сложений внутри блока по сравнению с последовательным
+        алгоритмом.
+        */
+        template <class U, class V>
+        void partial_sum_blocks(U * in, V * out, std::ptrdiff_t n)
+        {
+            using Add = simd_reduction<V, std::plus<>>;
+
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(V));
+
+            auto carry = details::simd_scan_identity<V>(std::is_floating_point<V>{});
+
+            std::ptrdiff_t i = 0;
+
+            for(; n - i >= lanes; i += lanes)
+            {
+                auto x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i));
+                x = Add::combine(carry, details::simd_scan<V>(x));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), x);
+
+                carry = details::simd_broadcast_last(x, std::integral_constant<std::size_t, sizeof(V)>{});
+            }
+
+            if(i == n)
+            {
+                return;
+            }
+
+            V value = (i == 0) ? V(in[0]) : V(out[i - 1] + in[i]);
+            out[i] = value;
+
+            for(++ i; i != n; ++ i)
+            {
+                value = value + in[i];
+                out[i] = value;
+            }
+        }
+#endif
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Частичные суммы
+    @details Суммы вычисляются строго слева направо, как в std::partial_sum,
+    поэтому для чисел с плавающей точкой результат побитово совпадает с
+    последовательным алгоритмом. Если вход и выход -- непрерывные
+    последовательности значений одного целого типа, а операция --
+    std::plus<>, суммы вычисляются поблочно с помощью SSE2, в том числе на
+    месте, когда выход совпадает со входом: для целых чисел результат от
+    этого не меняется. Если порядок сложений не важен, следует использовать
+    inclusive_scan.
+    */
     struct partial_sum_fn
     {
+    public:
         template <class InputSequence, class OutputSequence, class BinaryOperation = std::plus<>>
         std::pair<safe_cursor_type_t<InputSequence>, safe_cursor_type_t<OutputSequence>>
         operator()(InputSequence && in, OutputSequence && out,
@@ -73,6 +1287,17 @@ inline namespace v1
             auto in_cur = sayan::cursor_fwd<InputSequence>(in);
             auto out_cur = sayan::cursor_fwd<OutputSequence>(out);
 
+            using Scan = details::use_scan_kernel<decltype(in_cur), decltype(out_cur),
+                                                  BinaryOperation, false>;
+
+            return this->impl(std::move(in_cur), std::move(out_cur), op, Scan{});
+        }
+
+    private:
+        template <class InputCursor, class OutputCursor, class BinaryOperation>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, BinaryOperation & op, std::false_type) const
+        {
             if(!in_cur || !out_cur)
             {
                 return {std::move(in_cur), std::move(out_cur)};
@@ -90,10 +1315,266 @@ inline namespace v1
 
             return {std::move(in_cur), std::move(out_cur)};
         }
+
+#if defined(__SSE2__)
+        template <class InputCursor, class OutputCursor, class BinaryOperation>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, BinaryOperation & op, std::true_type) const
+        {
+            auto const n = std::min<std::ptrdiff_t>(in_cur.size(), out_cur.size());
+            auto const in = ::sayan::cursor_data(in_cur);
+            auto const out = ::sayan::cursor_data(out_cur);
+
+            if(!details::is_scan_overlap_safe(in, out, n))
+            {
+                return this->impl(std::move(in_cur), std::move(out_cur), op, std::false_type{});
+            }
+
+            details::partial_sum_blocks(in, out, n);
+
+            in_cur += n;
+            out_cur += n;
+
+            return {std::move(in_cur), std::move(out_cur)};
+        }
+#endif
+    };
+
+    /** @brief Частичные суммы без фиксированного порядка вычислений
+    @details Аналог std::inclusive_scan: операция @c op должна быть
+    ассоциативной, порядок её применения не определён. Если вход и выход --
+    непрерывные последовательности арифметических значений одного типа, а
+    операция -- std::plus<>, суммы вычисляются поблочно с помощью SSE2, в том
+    числе для float и double: суммы внутри блока из 16 байт вычисляются
+    сдвигами и сложениями, затем к ним прибавляется последняя сумма
+    предыдущего блока. Для чисел с плавающей точкой результат может
+    отличаться от partial_sum в последних разрядах.
+    */
+    struct inclusive_scan_fn
+    {
+    public:
+        template <class InputSequence, class OutputSequence, class BinaryOperation = std::plus<>>
+        std::pair<safe_cursor_type_t<InputSequence>, safe_cursor_type_t<OutputSequence>>
+        operator()(InputSequence && in, OutputSequence && out,
+                   BinaryOperation op = BinaryOperation{}) const
+        {
+            auto in_cur = sayan::cursor_fwd<InputSequence>(in);
+            auto out_cur = sayan::cursor_fwd<OutputSequence>(out);
+
+            using Scan = details::use_scan_kernel<decltype(in_cur), decltype(out_cur),
+                                                  BinaryOperation, true>;
+
+            return this->impl(std::move(in_cur), std::move(out_cur), op, Scan{});
+        }
+
+    private:
+        template <class InputCursor, class OutputCursor, class BinaryOperation>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, BinaryOperation & op, std::false_type) const
+        {
+            return ::sayan::partial_sum_fn{}(std::move(in_cur), std::move(out_cur), op);
+        }
+
+#if defined(__SSE2__)
+        template <class InputCursor, class OutputCursor, class BinaryOperation>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, BinaryOperation & op, std::true_type) const
+        {
+            auto const n = std::min<std::ptrdiff_t>(in_cur.size(), out_cur.size());
+            auto const in = ::sayan::cursor_data(in_cur);
+            auto const out = ::sayan::cursor_data(out_cur);
+
+            if(!details::is_scan_overlap_safe(in, out, n))
+            {
+                return this->impl(std::move(in_cur), std::move(out_cur), op, std::false_type{});
+            }
+
+            details::partial_sum_blocks(in, out, n);
+
+            in_cur += n;
+            out_cur += n;
+
+            return {std::move(in_cur), std::move(out_cur)};
+        }
+#endif
     };
 
+    /// @cond false
+    namespace details
+    {
+        // Поэлементное вычитание блоков по 16 байт
+        template <class T, bool = std::is_floating_point<T>::value, std::size_t = sizeof(T)>
+        struct simd_subtraction
+         : std::false_type
+        {};
+
+#if defined(__SSE2__)
+        template <class T>
+        struct simd_subtraction<T, false, 1>
+         : std::true_type
+        {
+            static __m128i apply(__m128i x, __m128i y)
+            {
+                return _mm_sub_epi8(x, y);
+            }
+        };
+
+        template <class T>
+        struct simd_subtraction<T, false, 2>
+         : std::true_type
+        {
+            static __m128i apply(__m128i x, __m128i y)
+            {
+                return _mm_sub_epi16(x, y);
+            }
+        };
+
+        template <class T>
+        struct simd_subtraction<T, false, 4>
+         : std::true_type
+        {
+            static __m128i apply(__m128i x, __m128i y)
+            {
+                return _mm_sub_epi32(x, y);
+            }
+        };
+
+        template <class T>
+        struct simd_subtraction<T, false, 8>
+         : std::true_type
+        {
+            static __m128i apply(__m128i x, __m128i y)
+            {
+                return _mm_sub_epi64(x, y);
+            }
+        };
+
+        template <class T>
+        struct simd_subtraction<T, true, 4>
+         : std::true_type
+        {
+            static __m128i apply(__m128i x, __m128i y)
+            {
+                return _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(x), _mm_castsi128_ps(y)));
+            }
+        };
+
+        template <class T>
+        struct simd_subtraction<T, true, 8>
+         : std::true_type
+        {
+            static __m128i apply(__m128i x, __m128i y)
+            {
+                return _mm_castpd_si128(_mm_sub_pd(_mm_castsi128_pd(x), _mm_castsi128_pd(y)));
+            }
+        };
+#endif
+
+        template <class U, class V, class BinaryOperation>
+        struct is_simd_difference_compatible
+         : std::integral_constant<bool, std::is_same<BinaryOperation, std::minus<>>::value
+                                        && std::is_same<std::remove_cv_t<U>, V>::value
+                                        && !std::is_volatile<U>::value
+                                        && is_reassociable_arithmetic<V>::value
+                                        && simd_subtraction<V>::value
+                                        && 16 % sizeof(V) == 0>
+        {};
+
+        template <class InputCursor, class OutputCursor, class BinaryOperation,
+                  bool = ::sayan::is_contiguous_cursor<InputCursor>::value
+                         && ::sayan::is_contiguous_cursor<OutputCursor>::value>
+        struct use_difference_kernel
+         : std::false_type
+        {};
+
+        template <class InputCursor, class OutputCursor, class BinaryOperation>
+        struct use_difference_kernel<InputCursor, OutputCursor, BinaryOperation, true>
+         : is_simd_difference_compatible<std::remove_pointer_t<::sayan::contiguous_pointer_t<InputCursor>>,
+                                         std::remove_pointer_t<::sayan::contiguous_pointer_t<OutputCursor>>,
+                                         BinaryOperation>
+        {};
+
+#if defined(__SSE2__)
+        /* Разности вычисляются из двух загрузок, сдвинутых на один элемент.
+        Блоки обрабатываются от начала к концу, что допустимо, если выход не
+        пересекается со входом или начинается раньше него: запись затрагивает
+        только уже прочитанные элементы.
+        */
+        template <class U, class V>
+        void adjacent_difference_blocks(U * in, V * out, std::ptrdiff_t n, std::false_type)
+        {
+            using Subtraction = simd_subtraction<V>;
+
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(V));
+
+            auto const load = [](U * p)
+            {
+                return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+            };
+
+            out[0] = in[0];
+
+            std::ptrdiff_t i = 1;
+
+            for(; n - i >= lanes; i += lanes)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                                 Subtraction::apply(load(in + i), load(in + i - 1)));
+            }
+
+            for(; i != n; ++ i)
+            {
+                out[i] = in[i] - in[i - 1];
+            }
+        }
+
+        /* На месте блоки обрабатываются от конца к началу, чтобы каждый
+        элемент был прочитан до того, как будет заменён разностью
+        */
+        template <class U, class V>
+        void adjacent_difference_blocks(U * in, V * out, std::ptrdiff_t n, std::true_type)
+        {
+            using Subtraction = simd_subtraction<V>;
+
+            constexpr auto lanes = static_cast<std::ptrdiff_t>(16 / sizeof(V));
+
+            auto const load = [](U * p)
+            {
+                return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+            };
+
+            auto i = n;
+
+            for(; i - 1 >= lanes; i -= lanes)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i - lanes),
+                                 Subtraction::apply(load(in + i - lanes), load(in + i - lanes - 1)));
+            }
+
+            for(-- i; i > 0; -- i)
+            {
+                out[i] = in[i] - in[i - 1];
+            }
+
+            out[0] = in[0];
+        }
+#endif
+    }
+    // namespace details
+    /// @endcond
+
+    /** @brief Разности соседних элементов
+    @details Если вход и выход -- непрерывные последовательности
+    арифметических значений одного типа, а операция -- std::minus<>, разности
+    вычисляются поблочно с помощью SSE2, в том числе на месте. Каждая
+    разность вычисляется одной операцией, поэтому результат совпадает с
+    последовательным алгоритмом и для чисел с плавающей точкой. Обратное
+    преобразование (восстановление значений по разностям) выполняет
+    partial_sum.
+    */
     struct adjacent_difference_fn
     {
+    public:
         template <class InputSequence, class OutputSequence, class BinaryOperation = std::minus<>>
         std::pair<safe_cursor_type_t<InputSequence>, safe_cursor_type_t<OutputSequence>>
         operator()(InputSequence && in, OutputSequence && out,
@@ -102,6 +1583,17 @@ inline namespace v1
             auto in_cur = sayan::cursor_fwd<InputSequence>(in);
             auto out_cur = sayan::cursor_fwd<OutputSequence>(out);
 
+            using Kernel = details::use_difference_kernel<decltype(in_cur), decltype(out_cur),
+                                                          BinaryOperation>;
+
+            return this->impl(std::move(in_cur), std::move(out_cur), op, Kernel{});
+        }
+
+    private:
+        template <class InputCursor, class OutputCursor, class BinaryOperation>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, BinaryOperation & op, std::false_type) const
+        {
             if(!in_cur || !out_cur)
             {
                 return {std::move(in_cur), std::move(out_cur)};
@@ -120,14 +1612,51 @@ inline namespace v1
 
             return {std::move(in_cur), std::move(out_cur)};
         }
+
+#if defined(__SSE2__)
+        template <class InputCursor, class OutputCursor, class BinaryOperation>
+        std::pair<InputCursor, OutputCursor>
+        impl(InputCursor in_cur, OutputCursor out_cur, BinaryOperation & op, std::true_type) const
+        {
+            auto const n = std::min<std::ptrdiff_t>(in_cur.size(), out_cur.size());
+            auto const in = ::sayan::cursor_data(in_cur);
+            auto const out = ::sayan::cursor_data(out_cur);
+
+            if(n == 0)
+            {
+                return {std::move(in_cur), std::move(out_cur)};
+            }
+
+            if(static_cast<void const *>(in) == static_cast<void const *>(out))
+            {
+                details::adjacent_difference_blocks(in, out, n, std::true_type{});
+            }
+            else if(details::is_scan_overlap_safe(in, out, n))
+            {
+                details::adjacent_difference_blocks(in, out, n, std::false_type{});
+            }
+            else
+            {
+                return this->impl(std::move(in_cur), std::move(out_cur), op, std::false_type{});
+            }
+
+            in_cur += n;
+            out_cur += n;
+
+            return {std::move(in_cur), std::move(out_cur)};
+        }
+#endif
     };
 
     namespace
     {
         constexpr auto const & iota = ::sayan::static_const<::sayan::iota_fn>;
         constexpr auto const & accumulate = ::sayan::static_const<::sayan::accumulate_fn>;
+        constexpr auto const & reduce = ::sayan::static_const<::sayan::reduce_fn>;
         constexpr auto const & inner_product = ::sayan::static_const<::sayan::inner_product_fn>;
+        constexpr auto const & transform_reduce = ::sayan::static_const<::sayan::transform_reduce_fn>;
         constexpr auto const & partial_sum = ::sayan::static_const<::sayan::partial_sum_fn>;
+        constexpr auto const & inclusive_scan = ::sayan::static_const<::sayan::inclusive_scan_fn>;
         constexpr auto const & adjacent_difference
             = sayan::static_const<::sayan::adjacent_difference_fn>;
     }
@@ -0,0 +1,88 @@
+#ifndef Z_SAYAN_UTILITY_FUNCTION_HOLDER_HPP_INCLUDED
+#define Z_SAYAN_UTILITY_FUNCTION_HOLDER_HPP_INCLUDED
+
+/** @file sayan/utility/function_holder.hpp
+ @brief Обёртка для хранения функциональных объектов в адаптерах курсоров.
+ @details Курсоры копируются и присваиваются алгоритмами, а замыкания не
+ поддерживают присваивание. Обёртка делает присваиваемым любой копируемый
+ функциональный объект: при присваивании хранимый объект пересоздаётся.
+*/
+
+#include <experimental/optional>
+#include <type_traits>
+#include <utility>
+
+namespace sayan
+{
+inline namespace v1
+{
+    /** @brief Обёртка, хранящая функциональный объект
+    @tparam F тип функционального объекта
+    */
+    template <class F, bool = std::is_copy_assignable<F>::value>
+    class function_holder
+    {
+    public:
+        // Создание
+        explicit function_holder(F f)
+         : f_(std::move(f))
+        {}
+
+        // Доступ к функциональному объекту
+        F const & function() const
+        {
+            return this->f_;
+        }
+
+    private:
+        F f_;
+    };
+
+    template <class F>
+    class function_holder<F, false>
+    {
+    public:
+        // Создание, копирование, уничтожение
+        explicit function_holder(F f)
+         : f_(std::move(f))
+        {}
+
+        function_holder(function_holder const &) = default;
+        function_holder(function_holder &&) = default;
+
+        function_holder & operator=(function_holder const & x)
+        {
+            if(this != &x)
+            {
+                this->f_.emplace(x.function());
+            }
+
+            return *this;
+        }
+
+        function_holder & operator=(function_holder && x)
+        {
+            if(this != &x)
+            {
+                this->f_.emplace(std::move(*x.f_));
+            }
+
+            return *this;
+        }
+
+        // Доступ к функциональному объекту
+        F const & function() const
+        {
+            return *this->f_;
+        }
+
+    private:
+        std::experimental::optional<F> f_;
+    };
+}
+// namespace v1
+}
+// namespace sayan
+
+#endif
+// Z_SAYAN_UTILITY_FUNCTION_HOLDER_HPP_INCLUDED
@@ -0,0 +1,96 @@
+/* Замер скорости sayan::fill в зависимости от размера заполняемого буфера.
+
+Сборка и запуск (из корня репозитория):
+    g++ -std=gnu++14 -O2 -march=native -Iinclude sayan_bench/fill.cpp -o fill_bench
+    ./fill_bench
+
+Для каждого размера буфера печатается скорость (ГБ/с) заполнения с помощью
+sayan::fill, std::fill и поэлементного цикла по курсору, которым sayan::fill
+был реализован раньше. На размерах, превышающих кэш последнего уровня,
+видна разница между записью через кэш и записью в обход кэша.
+*/
+
+#include <sayan/algorithm.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    // Прежняя реализация sayan::fill
+    template <class T>
+    void cursor_loop_fill(std::vector<T> & xs, T const & value)
+    {
+        for(auto cur = sayan::cursor(xs); !!cur; ++ cur)
+        {
+            *cur = value;
+        }
+    }
+
+    // Запрещает компилятору считать записи в буфер ненужными
+    inline void clobber(void const * p)
+    {
+        asm volatile("" : : "g"(p) : "memory");
+    }
+
+    template <class F>
+    double measure_gbps(std::size_t bytes, F f)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        // Около 1 ГБ записи на каждый замер, но не менее трёх повторений
+        auto const repeats = std::max<std::size_t>(3, (std::size_t(1) << 30) / bytes);
+
+        f();
+
+        auto const start = Clock::now();
+        for(std::size_t i = 0; i != repeats; ++ i)
+        {
+            f();
+        }
+        std::chrono::duration<double> const elapsed = Clock::now() - start;
+
+        return static_cast<double>(bytes) * repeats / elapsed.count() / 1e9;
+    }
+
+    template <class T>
+    void sweep(char const * name, T const value)
+    {
+        std::printf("%s\n%12s %12s %12s %12s\n", name, "bytes", "sayan::fill", "std::fill", "cursor loop");
+
+        for(std::size_t bytes = std::size_t(1) << 12; bytes <= (std::size_t(1) << 28); bytes <<= 2)
+        {
+            std::vector<T> xs(bytes / sizeof(T));
+
+            auto const sayan_gbps = measure_gbps(bytes, [&]
+            {
+                sayan::fill(xs, value);
+                clobber(xs.data());
+            });
+            auto const std_gbps = measure_gbps(bytes, [&]
+            {
+                std::fill(xs.begin(), xs.end(), value);
+                clobber(xs.data());
+            });
+            auto const loop_gbps = measure_gbps(bytes, [&]
+            {
+                cursor_loop_fill(xs, value);
+                clobber(xs.data());
+            });
+
+            std::printf("%12zu %12.2f %12.2f %12.2f\n", bytes, sayan_gbps, std_gbps, loop_gbps);
+        }
+
+        std::printf("\n");
+    }
+}
+
+int main()
+{
+    sweep<char>("char", 'x');
+    sweep<std::int32_t>("int32_t", 42);
+    sweep<double>("double", 2.5);
+}
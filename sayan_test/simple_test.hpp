@@ -38,6 +38,23 @@ namespace test
         return arbitrary<T>::make();
     }
 
+    template <class T>
+    struct type_tag
+    {
+        using type = T;
+    };
+
+    /** @brief Вызывает @c f(type_tag<T>{}) для каждого из типов @c Types
+    @details Позволяет записать проверку для нескольких типов элементов одной
+    обобщённой лямбдой прямо в теле теста.
+    */
+    template <class... Types, class Function>
+    void for_each_type(Function f)
+    {
+        using expand = int[];
+        (void)expand{0, (f(type_tag<Types>{}), 0)...};
+    }
+
     template <class Container>
     Container get_arbitrary_container(typename Container::size_type n)
     {
@@ -1,7 +1,12 @@
 #include <sayan/algorithm.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <forward_list>
+#include <limits>
+#include <vector>
 
+#include "../../simple_test.hpp"
 #include <catch/catch.hpp>
 
 TEST_CASE("algorithm/min_element")
@@ -92,3 +97,178 @@ TEST_CASE("algorithm/minmax_element: custom predicate")
     CHECK(r.second.begin() == r_max.begin());
     CHECK(r.second.end() == r_max.end());
 }
+
+TEST_CASE("algorithm/minmax_element: single pass, ties")
+{
+    std::vector<std::vector<int>> const inputs{{7}, {2, 2}, {1, 3}, {3, 1}, {2, 1, 1, 3, 3},
+                                               {5, 5, 5, 5, 5, 5}, {4, 1, 4, 1, 4, 1, 4}};
+
+    for(auto const & src : inputs)
+    {
+        std::forward_list<int> const xs(src.begin(), src.end());
+
+        auto n_cmp = 0;
+        auto const cmp = [&n_cmp](int x, int y) { ++ n_cmp; return x < y; };
+
+        auto const r_std = std::minmax_element(xs.begin(), xs.end());
+        auto const r = sayan::minmax_element(xs, cmp);
+
+        CHECK(r.first.begin() == r_std.first);
+        CHECK(r.second.begin() == r_std.second);
+
+        auto const n = static_cast<int>(src.size());
+        CHECK(n_cmp <= std::max(3 * (n - 1) / 2, 0) + 1);
+    }
+}
+
+TEST_CASE("algorithm/minmax_element: empty")
+{
+    std::forward_list<int> const xs{};
+
+    auto const r = sayan::minmax_element(xs);
+
+    CHECK(!r.first);
+    CHECK(!r.second);
+}
+
+TEST_CASE("algorithm/minmax_element: contiguous arithmetic")
+{
+    sayan::test::for_each_type<std::int8_t, std::uint8_t, std::int16_t, std::uint16_t,
+                               std::int32_t, std::uint32_t, std::int64_t, float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        // Последняя длина больше, чем умещается номеров блоков в байтовом счётчике
+        for(std::size_t n : {1, 2, 15, 16, 17, 100, 257, 16 * 256 * 3 + 11})
+        for(unsigned modulo : {1, 7, 100, 251})
+        {
+            CAPTURE(n);
+            CAPTURE(modulo);
+
+            std::vector<T> xs(n);
+
+            for(std::size_t i = 0; i != n; ++ i)
+            {
+                xs[i] = static_cast<T>(static_cast<int>((i * 2654435761u) % modulo)
+                                       - static_cast<int>(modulo / 3));
+            }
+
+            auto const r_std = std::minmax_element(xs.begin(), xs.end());
+            auto const r = sayan::minmax_element(xs);
+
+            CHECK(r.first.traversed_begin() == xs.begin());
+            CHECK(r.first.begin() == r_std.first);
+            CHECK(r.first.end() == xs.end());
+
+            CHECK(r.second.traversed_begin() == xs.begin());
+            CHECK(r.second.begin() == r_std.second);
+            CHECK(r.second.end() == xs.end());
+        }
+    });
+}
+
+TEST_CASE("algorithm/minmax_element: contiguous floating point with NaN")
+{
+    auto const nan = std::numeric_limits<double>::quiet_NaN();
+
+    std::vector<double> xs(37);
+    for(std::size_t i = 0; i != xs.size(); ++ i)
+    {
+        xs[i] = static_cast<double>(i % 5);
+    }
+
+    for(std::size_t pos : {0, 1, 20, 36})
+    {
+        CAPTURE(pos);
+
+        auto ys = xs;
+        ys[pos] = nan;
+
+        std::forward_list<double> const zs(ys.begin(), ys.end());
+
+        auto const r = sayan::minmax_element(ys);
+        auto const r_seq = sayan::minmax_element(zs);
+
+        CHECK(r.first.begin() - ys.begin() == std::distance(zs.begin(), r_seq.first.begin()));
+        CHECK(r.second.begin() - ys.begin() == std::distance(zs.begin(), r_seq.second.begin()));
+    }
+}
+
+TEST_CASE("algorithm/min_element, max_element: contiguous arithmetic")
+{
+    sayan::test::for_each_type<std::int8_t, std::uint8_t, std::int16_t, std::uint16_t,
+                               std::int32_t, std::uint32_t, float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        // Последняя длина больше, чем умещается номеров блоков в байтовом счётчике
+        for(std::size_t n : {1, 3, 16, 31, 64, 200, 16 * 256 * 2 + 7})
+        for(unsigned modulo : {1, 5, 113, 1000})
+        {
+            CAPTURE(n);
+            CAPTURE(modulo);
+
+            std::vector<T> xs(n);
+
+            for(std::size_t i = 0; i != n; ++ i)
+            {
+                xs[i] = static_cast<T>(static_cast<int>((i * 40503u) % modulo)
+                                       - static_cast<int>(modulo / 2));
+            }
+
+            auto const r_min = sayan::min_element(xs);
+
+            CHECK(r_min.traversed_begin() == xs.begin());
+            CHECK(r_min.begin() == std::min_element(xs.begin(), xs.end()));
+            CHECK(r_min.end() == xs.end());
+
+            // Последний из наибольших элементов
+            auto const last_max = std::max_element(xs.rbegin(), xs.rend()).base() - 1;
+            auto const r_max = sayan::max_element(xs);
+
+            CHECK(r_max.traversed_begin() == xs.begin());
+            CHECK(r_max.begin() == last_max);
+            CHECK(r_max.end() == xs.end());
+        }
+    });
+}
+
+TEST_CASE("algorithm/min_element, max_element: contiguous, signed zero")
+{
+    std::vector<float> const xs{1.0f, 0.0f, 2.0f, -0.0f, 3.0f, 0.0f, 3.0f, 1.0f,
+                                -0.0f, 0.5f, 3.0f, 2.0f, 1.0f, 0.0f, 0.25f, 1.0f, 3.0f, 1.0f};
+
+    CHECK(sayan::min_element(xs).begin() == xs.begin() + 1);
+    CHECK(sayan::max_element(xs).begin() == xs.begin() + 16);
+}
+
+TEST_CASE("algorithm/min_element, max_element: contiguous floating point with NaN")
+{
+    auto const nan = std::numeric_limits<float>::quiet_NaN();
+
+    std::vector<float> xs(45);
+    for(std::size_t i = 0; i != xs.size(); ++ i)
+    {
+        xs[i] = static_cast<float>(i % 9) - 4.0f;
+    }
+
+    for(std::size_t pos : {0, 4, 13, 30, 44})
+    {
+        CAPTURE(pos);
+
+        auto ys = xs;
+        ys[pos] = nan;
+
+        std::forward_list<float> const zs(ys.begin(), ys.end());
+
+        auto const r_min = sayan::min_element(ys);
+        auto const r_max = sayan::max_element(ys);
+
+        CHECK(r_min.begin() - ys.begin() == std::distance(zs.begin(), sayan::min_element(zs).begin()));
+        CHECK(r_max.begin() - ys.begin() == std::distance(zs.begin(), sayan::max_element(zs).begin()));
+    }
+
+    // NaN в начале последовательности не меньше ни одного элемента
+    xs.front() = nan;
+    CHECK(sayan::min_element(xs).begin() == xs.begin());
+}
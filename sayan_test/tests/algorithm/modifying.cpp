@@ -4,8 +4,16 @@
 
 #include <algorithm>
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <forward_list>
+#include <limits>
+#include <memory>
+#include <numeric>
 #include <list>
+#include <string>
+#include <vector>
 
 #include "../../simple_test.hpp"
 #include <catch/catch.hpp>
@@ -475,6 +483,144 @@ TEST_CASE("algorithm/fill")
     CHECK(xs == obj);
 }
 
+TEST_CASE("algorithm/fill: contiguous, bytes")
+{
+    std::string xs(37, 'a');
+
+    sayan::fill(xs, 'z');
+    CHECK(xs == std::string(37, 'z'));
+
+    std::vector<signed char> ys(5, 0);
+
+    sayan::fill(ys, -3);
+    CHECK(ys == std::vector<signed char>(5, -3));
+
+    std::vector<unsigned char> zs(7, 0);
+    auto cur = sayan::cursor(zs);
+    cur += 2;
+
+    sayan::fill(cur, 255);
+    CHECK(zs == (std::vector<unsigned char>{0, 0, 255, 255, 255, 255, 255}));
+}
+
+TEST_CASE("algorithm/fill: contiguous, wide values")
+{
+    std::vector<double> xs(19, 0.0);
+
+    sayan::fill(xs, 2.5);
+    CHECK(xs == std::vector<double>(19, 2.5));
+
+    // Заполняемое значение является элементом последовательности
+    std::vector<int> ys{7, 1, 2, 3};
+    sayan::fill(ys, ys.front());
+    CHECK(ys == std::vector<int>(4, 7));
+
+    std::vector<std::string> zs(3, "abc");
+    sayan::fill(zs, "xyz");
+    CHECK(zs == std::vector<std::string>(3, "xyz"));
+}
+
+namespace
+{
+    // Присваивание целого числа отличается от создания из него
+    struct fill_test_twice
+    {
+        explicit fill_test_twice(int x)
+         : value(x)
+        {}
+
+        fill_test_twice & operator=(int x)
+        {
+            this->value = 2 * x;
+            return *this;
+        }
+
+        int value;
+    };
+}
+
+TEST_CASE("algorithm/fill: contiguous, element assigned from another type")
+{
+    static_assert(std::is_trivially_copyable<fill_test_twice>::value, "");
+
+    std::vector<fill_test_twice> xs(5, fill_test_twice(0));
+
+    sayan::fill(xs, 3);
+
+    CHECK(std::all_of(xs.begin(), xs.end(), [](fill_test_twice const & x) { return x.value == 6; }));
+
+    sayan::fill(xs, fill_test_twice(3));
+
+    CHECK(std::all_of(xs.begin(), xs.end(), [](fill_test_twice const & x) { return x.value == 3; }));
+}
+
+TEST_CASE("algorithm/fill_n: contiguous")
+{
+    std::vector<short> xs(10, 0);
+
+    auto const r = sayan::fill_n(xs, 6, 5);
+
+    CHECK(r.begin() == xs.begin() + 6);
+    CHECK(xs == (std::vector<short>{5, 5, 5, 5, 5, 5, 0, 0, 0, 0}));
+}
+
+#if defined(__SSE2__)
+namespace
+{
+    struct alignas(16) fill_test_quad
+    {
+        int a, b, c, d;
+    };
+}
+
+TEST_CASE("algorithm/fill: broadcast and non-temporal kernels")
+{
+    sayan::test::for_each_type<std::int16_t, std::int32_t, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        auto const value = static_cast<T>(-2.5);
+
+        for(auto offset : {0, 1, 3})
+        {
+            CAPTURE(offset);
+
+            std::vector<T> xs(101, T(0));
+            std::vector<T> ys(101, T(0));
+
+            sayan::details::fill_broadcast(xs.data() + offset, xs.data() + xs.size() - 1, value);
+            sayan::details::fill_nontemporal(ys.data() + offset, ys.data() + ys.size() - 1, value);
+
+            for(std::size_t i = 0; i != xs.size(); ++ i)
+            {
+                CAPTURE(i);
+
+                auto const inside = static_cast<std::size_t>(offset) <= i && i + 1 != xs.size();
+
+                CHECK(xs[i] == (inside ? value : T(0)));
+                CHECK(ys[i] == (inside ? value : T(0)));
+            }
+        }
+    });
+
+    std::vector<fill_test_quad> qs(11, fill_test_quad{0, 0, 0, 0});
+    auto rs = qs;
+
+    sayan::details::fill_broadcast(qs.data() + 1, qs.data() + qs.size(), fill_test_quad{1, 2, 3, 4});
+    sayan::details::fill_nontemporal(rs.data() + 1, rs.data() + rs.size(), fill_test_quad{1, 2, 3, 4});
+
+    auto const is_filled = [](fill_test_quad const & q)
+    {
+        return q.a == 1 && q.b == 2 && q.c == 3 && q.d == 4;
+    };
+
+    CHECK(qs.front().a == 0);
+    CHECK(std::all_of(qs.begin() + 1, qs.end(), is_filled));
+    CHECK(rs.front().a == 0);
+    CHECK(std::all_of(rs.begin() + 1, rs.end(), is_filled));
+}
+#endif
+
 TEST_CASE("algorithm/fill_n: minimalistic")
 {
     auto const n = ::sayan::test::random_integral<size_t>(0, 20);
@@ -820,6 +966,108 @@ TEST_CASE("algorithm/move_backward")
     }
 }
 
+TEST_CASE("algorithm/copy: contiguous, trivially copyable")
+{
+    std::vector<int> const src{3, 1, 4, 1, 5, 9, 2, 6};
+
+    for(auto n : {0, 3, 8, 11})
+    {
+        CAPTURE(n);
+
+        std::vector<int> dest(n, -1);
+
+        auto const r = sayan::copy(src, dest);
+
+        auto const N = std::min(src.size(), dest.size());
+
+        CHECK(r.first.traversed_begin() == src.begin());
+        CHECK(r.first.begin() == src.begin() + N);
+        CHECK(r.second.traversed_begin() == dest.begin());
+        CHECK(r.second.begin() == dest.begin() + N);
+        CHECK(std::equal(dest.begin(), dest.begin() + N, src.begin()));
+        CHECK(std::all_of(dest.begin() + N, dest.end(), [](int x) { return x == -1; }));
+    }
+}
+
+TEST_CASE("algorithm/copy: contiguous, overlapping to the left")
+{
+    std::vector<int> xs{1, 2, 3, 4, 5, 6};
+
+    auto in = sayan::cursor(xs);
+    in += 2;
+
+    auto const r = sayan::copy(in, xs);
+
+    CHECK(xs == (std::vector<int>{3, 4, 5, 6, 5, 6}));
+    CHECK(r.second.begin() == xs.begin() + 4);
+}
+
+TEST_CASE("algorithm/copy: array to string")
+{
+    char const src[] = {'a', 'b', 'c'};
+    std::string dest("xyzw");
+
+    auto const r = sayan::copy(src, dest);
+
+    CHECK(dest == "abcw");
+    CHECK(r.first.begin() == std::end(src));
+    CHECK(r.second.begin() == dest.begin() + 3);
+}
+
+TEST_CASE("algorithm/move: contiguous, trivially copyable")
+{
+    std::vector<double> const src{2.5, 0.5, -1.0};
+    std::vector<double> dest(2, 0.0);
+
+    auto src_moved = src;
+    auto const r = sayan::move(src_moved, dest);
+
+    CHECK(dest == (std::vector<double>{2.5, 0.5}));
+    CHECK(r.first.begin() == src_moved.begin() + 2);
+    CHECK(r.second.begin() == dest.end());
+}
+
+TEST_CASE("algorithm/copy_backward: contiguous, trivially copyable")
+{
+    std::vector<int> const src{3, 1, 4, 1, 5};
+
+    for(auto n : {0, 3, 5, 7})
+    {
+        CAPTURE(n);
+
+        std::vector<int> dest(n, -1);
+        auto dest_std = dest;
+
+        auto const r = sayan::copy_backward(src, dest);
+
+        auto const N = std::min(src.size(), dest.size());
+        std::copy_backward(src.end() - N, src.end(), dest_std.end());
+
+        CHECK(dest == dest_std);
+
+        CHECK(r.first.begin() == src.begin());
+        CHECK(r.first.end() == src.end() - N);
+        CHECK(r.first.traversed_end() == src.end());
+        CHECK(r.second.begin() == dest.begin());
+        CHECK(r.second.end() == dest.end() - N);
+        CHECK(r.second.traversed_end() == dest.end());
+    }
+}
+
+TEST_CASE("algorithm/move_backward: contiguous, overlapping to the right")
+{
+    std::vector<int> xs{1, 2, 3, 4, 5, 6};
+
+    auto in = sayan::cursor(xs);
+    in.drop(sayan::back, 2);
+
+    auto const r = sayan::move_backward(in, xs);
+
+    CHECK(xs == (std::vector<int>{1, 2, 1, 2, 3, 4}));
+    CHECK(r.first.end() == xs.begin());
+    CHECK(r.second.end() == xs.begin() + 2);
+}
+
 TEST_CASE("algorithm/remove_copy_if: to shorter")
 {
     std::string const src{"Bjarne Stroustrup"};
@@ -943,6 +1191,109 @@ TEST_CASE("algorithm/copy_if: to longer")
     CHECK(std::get<1>(result).end() == dest.end());
 }
 
+TEST_CASE("algorithm/copy_if: contiguous arithmetic")
+{
+    sayan::test::for_each_type<char, std::uint16_t, std::int32_t, std::int64_t,
+                               float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        auto const pred = [](T const & x) { return static_cast<int>(x) % 3 != 0; };
+
+        for(std::size_t n : {0, 1, 63, 64, 65, 200, 1000})
+        {
+            std::vector<T> src(n);
+            for(std::size_t i = 0; i != n; ++ i)
+            {
+                src[i] = static_cast<T>(i * 7 % 11);
+            }
+
+            std::vector<T> expected;
+            std::copy_if(src.begin(), src.end(), std::back_inserter(expected), pred);
+
+            for(std::size_t capacity : {std::size_t(0), expected.size() / 3, expected.size(), n + 5})
+            {
+                CAPTURE(n);
+                CAPTURE(capacity);
+
+                std::vector<T> out(capacity, T(42));
+
+                std::size_t calls = 0;
+                auto const counting_pred = [&](T const & x) { ++ calls; return pred(x); };
+
+                auto const r = sayan::copy_if(src, out, counting_pred);
+
+                auto const written = std::min(capacity, expected.size());
+
+                CHECK(std::equal(out.begin(), out.begin() + written, expected.begin()));
+                CHECK(std::all_of(out.begin() + written, out.end(), [](T x) { return x == T(42); }));
+                CHECK(r.second.begin() == out.begin() + written);
+
+                // Вход проходится до элемента, заполнившего выход, включительно
+                auto const stop = r.first.begin();
+                CHECK(static_cast<std::size_t>(std::count_if(src.begin(), stop, pred)) == written);
+                CHECK((stop == src.end() || written == capacity));
+                CHECK((stop == src.begin() || written < capacity || pred(stop[-1])));
+                CHECK(calls == static_cast<std::size_t>(stop - src.begin()));
+
+                std::vector<T> out_remove(capacity, T(42));
+                sayan::remove_copy_if(src, out_remove, std::experimental::not_fn(pred));
+
+                CHECK(out_remove == out);
+            }
+
+            auto xs = src;
+            auto const r_remove = sayan::remove_if(xs, std::experimental::not_fn(pred));
+
+            CHECK(r_remove.begin() == xs.begin() + expected.size());
+            CHECK(std::equal(expected.begin(), expected.end(), xs.begin()));
+            CHECK(std::equal(r_remove.begin(), r_remove.end(), src.begin() + expected.size()));
+        }
+    });
+}
+
+TEST_CASE("algorithm/copy_if: contiguous, overlapping output")
+{
+    std::vector<int> src(150);
+    for(std::size_t i = 0; i != src.size(); ++ i)
+    {
+        src[i] = static_cast<int>(i % 4);
+    }
+
+    auto const pred = [](int x) { return x != 0; };
+
+    for(std::ptrdiff_t shift : {-5, -1, 0, 1, 5})
+    {
+        CAPTURE(shift);
+
+        std::vector<int> buffer(160, -1);
+        std::copy(src.begin(), src.end(), buffer.begin() + 5);
+
+        auto expected = buffer;
+        {
+            auto const in = expected.data() + 5;
+            auto out = in + shift;
+
+            for(std::size_t i = 0; i != src.size(); ++ i)
+            {
+                if(pred(in[i]))
+                {
+                    *out = in[i];
+                    ++ out;
+                }
+            }
+        }
+
+        auto const in = sayan::pointer_cursor_type<int>(buffer.data() + 5, buffer.data() + 155);
+        auto const out = sayan::pointer_cursor_type<int>(buffer.data() + 5 + shift,
+                                                         buffer.data() + 155 + shift);
+
+        sayan::copy_if(in, out, pred);
+
+        CHECK(buffer == expected);
+    }
+}
+
 TEST_CASE("algorithm/replace")
 {
     std::forward_list<int> xs_std{1,2,3,2,5,2};
@@ -1135,6 +1486,141 @@ TEST_CASE("algorithm/replace_copy_if: to shorter")
     CHECK(std::get<1>(result).end() == dest.end());
 }
 
+TEST_CASE("algorithm/replace: contiguous arithmetic")
+{
+    sayan::test::for_each_type<std::int8_t, std::uint16_t, std::int32_t, std::int64_t,
+                               float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        for(std::size_t n : {0, 1, 15, 16, 17, 40, 100, 333})
+        {
+            CAPTURE(n);
+
+            std::vector<T> src(n);
+            for(std::size_t i = 0; i != n; ++ i)
+            {
+                src[i] = static_cast<T>(i * 7 % 5);
+            }
+
+            auto const old_value = T(3);
+            auto const new_value = T(-1);
+
+            auto expected = src;
+            std::replace(expected.begin(), expected.end(), old_value, new_value);
+
+            auto xs = src;
+            auto const r = sayan::replace(xs, old_value, new_value);
+
+            CHECK(xs == expected);
+            CHECK(r.begin() == xs.end());
+
+            std::vector<T> out(n + 2, T(42));
+            auto const r_copy = sayan::replace_copy(src, out, old_value, new_value);
+
+            CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+            CHECK(out[n] == T(42));
+            CHECK(r_copy.first.begin() == src.end());
+            CHECK(r_copy.second.begin() == out.begin() + n);
+
+            auto const pred = [](T const & x) { return x == T(1) || x == T(4); };
+
+            auto expected_if = src;
+            std::replace_if(expected_if.begin(), expected_if.end(), pred, new_value);
+
+            auto ys = src;
+            auto const r_if = sayan::replace_if(ys, pred, new_value);
+
+            CHECK(ys == expected_if);
+            CHECK(r_if.begin() == ys.end());
+
+            std::vector<T> out_if(n / 2);
+            auto const r_copy_if = sayan::replace_copy_if(src, out_if, pred, new_value);
+
+            CHECK(std::equal(out_if.begin(), out_if.end(), expected_if.begin()));
+            CHECK(r_copy_if.first.begin() == src.begin() + n / 2);
+            CHECK(r_copy_if.second.begin() == out_if.end());
+        }
+    });
+}
+
+TEST_CASE("algorithm/replace: contiguous, value not representable in element type")
+{
+    std::vector<std::uint8_t> const src{0, 255, 44, 255, 1};
+
+    auto xs = src;
+    sayan::replace(xs, -1, 7);
+
+    CHECK(xs == src);
+
+    std::vector<std::uint8_t> out(src.size());
+    sayan::replace_copy(src, out, 300, 7);
+
+    CHECK(out == src);
+}
+
+TEST_CASE("algorithm/replace_if: sanitising sentinel values")
+{
+    auto const nan = std::numeric_limits<double>::quiet_NaN();
+
+    std::vector<double> xs(100, 1.5);
+    xs[3] = nan;
+    xs[64] = nan;
+    xs[99] = nan;
+
+    std::size_t calls = 0;
+    auto const is_nan = [&calls](double x) { ++ calls; return x != x; };
+
+    sayan::replace_if(xs, is_nan, 0.0);
+
+    CHECK(calls == xs.size());
+    CHECK(std::count(xs.begin(), xs.end(), 0.0) == 3);
+    CHECK(std::count(xs.begin(), xs.end(), 1.5) == 97);
+
+    std::vector<int> ids{5, -1, 7, -1, -1, 8};
+    std::vector<int> out(ids.size());
+
+    sayan::replace_copy_if(ids, out, [](int x) { return x < 0; }, 0);
+
+    CHECK(out == (std::vector<int>{5, 0, 7, 0, 0, 8}));
+}
+
+TEST_CASE("algorithm/replace_copy: contiguous, overlapping output")
+{
+    std::vector<int> src(50);
+    for(std::size_t i = 0; i != src.size(); ++ i)
+    {
+        src[i] = static_cast<int>(i % 3);
+    }
+
+    for(std::ptrdiff_t shift : {-5, -1, 0, 1, 5})
+    {
+        CAPTURE(shift);
+
+        std::vector<int> buffer(60, -1);
+        std::copy(src.begin(), src.end(), buffer.begin() + 5);
+
+        auto expected = buffer;
+        {
+            auto const in = expected.data() + 5;
+            auto const out = in + shift;
+
+            for(std::size_t i = 0; i != src.size(); ++ i)
+            {
+                out[i] = (in[i] == 1) ? 10 : in[i];
+            }
+        }
+
+        auto const in = sayan::pointer_cursor_type<int>(buffer.data() + 5, buffer.data() + 55);
+        auto const out = sayan::pointer_cursor_type<int>(buffer.data() + 5 + shift,
+                                                         buffer.data() + 55 + shift);
+
+        sayan::replace_copy(in, out, 1, 10);
+
+        CHECK(buffer == expected);
+    }
+}
+
 TEST_CASE("algorithm/unique")
 {
     std::forward_list<int> xs_std{1, 2, 2, 3, 3, 4, 5, 5, 6, 2, 3, 5};
@@ -1329,6 +1815,85 @@ TEST_CASE("algorithm/unique_copy: custom predicate, to shorter")
     CHECK(std::get<1>(result).end() == dest.end());
 }
 
+TEST_CASE("algorithm/unique: contiguous arithmetic")
+{
+    sayan::test::for_each_type<std::int8_t, std::uint16_t, std::int32_t,
+                               std::int64_t, float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        for(std::size_t n : {0, 1, 2, 15, 16, 17, 100, 1000})
+        {
+            // Серии разной длины, в том числе длиннее блока
+            std::size_t const runs[] = {1, 2, 1, 5, 1, 1, 40, 3};
+
+            std::vector<T> src;
+            for(std::size_t k = 0; src.size() < n; ++ k)
+            {
+                auto const run = std::min(runs[k % 8], n - src.size());
+                src.insert(src.end(), run, static_cast<T>(k % 100));
+            }
+
+            std::vector<T> expected;
+            std::unique_copy(src.begin(), src.end(), std::back_inserter(expected));
+
+            for(std::size_t capacity : {std::size_t(0), std::size_t(1), expected.size() / 2,
+                                        expected.size(), n + 3})
+            {
+                CAPTURE(n);
+                CAPTURE(capacity);
+
+                std::vector<T> out(capacity, T(42));
+                auto const r = sayan::unique_copy(src, out);
+
+                auto const written = std::min(capacity, expected.size());
+
+                CHECK(std::equal(out.begin(), out.begin() + written, expected.begin()));
+                CHECK(std::all_of(out.begin() + written, out.end(), [](T x) { return x == T(42); }));
+                CHECK(r.second.begin() == out.begin() + written);
+
+                // Вход проходится до элемента, заполнившего выход, включительно
+                std::vector<T> prefix;
+                std::unique_copy(src.begin(), r.first.begin(), std::back_inserter(prefix));
+
+                CHECK(prefix.size() == written);
+                CHECK((r.first.begin() == src.end() || written == capacity));
+                CHECK((r.first.begin() == src.begin() || written < capacity
+                       || r.first.begin() - src.begin() == 1
+                       || !(r.first.begin()[-1] == r.first.begin()[-2])));
+            }
+
+            auto xs = src;
+            auto const r_unique = sayan::unique(xs);
+
+            CHECK(r_unique.begin() == xs.begin() + expected.size());
+            CHECK(std::equal(expected.begin(), expected.end(), xs.begin()));
+            CHECK(std::equal(r_unique.begin(), r_unique.end(), src.begin() + expected.size()));
+        }
+    });
+}
+
+TEST_CASE("algorithm/unique: contiguous floating point, NaN and signed zeros")
+{
+    auto const nan = std::numeric_limits<double>::quiet_NaN();
+
+    std::vector<double> xs(40, 1.0);
+    xs[0] = 0.0;
+    xs[1] = -0.0;
+    xs[20] = nan;
+    xs[21] = nan;
+
+    auto const r = sayan::unique(xs);
+
+    REQUIRE(r.begin() - xs.begin() == 5);
+    CHECK(xs[0] == 0.0);
+    CHECK(!std::signbit(xs[0]));
+    CHECK(xs[1] == 1.0);
+    CHECK(std::isnan(xs[2]));
+    CHECK(std::isnan(xs[3]));
+    CHECK(xs[4] == 1.0);
+}
+
 TEST_CASE("algorithm/swap_ranges")
 {
     std::forward_list<int> xs1{1,3,5,7};
@@ -1382,6 +1947,48 @@ TEST_CASE("algorithm/swap_ranges: different sizes")
     CHECK(xs2 == xs2_old);
 }
 
+TEST_CASE("algorithm/swap_ranges: contiguous, trivially copyable")
+{
+    for(std::size_t n : {0, 1, 7, 8, 9, 31, 100})
+    {
+        CAPTURE(n);
+
+        std::vector<std::int16_t> xs1(n);
+        std::vector<std::int16_t> xs2(n + 3);
+        std::iota(xs1.begin(), xs1.end(), 0);
+        std::iota(xs2.begin(), xs2.end(), 1000);
+
+        auto const xs1_old = xs1;
+        auto const xs2_old = xs2;
+
+        auto const r = sayan::swap_ranges(xs1, xs2);
+
+        CHECK(xs1 == std::vector<std::int16_t>(xs2_old.begin(), xs2_old.begin() + n));
+        CHECK(std::equal(xs2.begin(), xs2.begin() + n, xs1_old.begin()));
+        CHECK(std::equal(xs2.begin() + n, xs2.end(), xs2_old.begin() + n));
+
+        CHECK(r.first.begin() == xs1.end());
+        CHECK(r.second.begin() == xs2.begin() + n);
+    }
+}
+
+TEST_CASE("algorithm/swap_ranges: contiguous, overlapping ranges")
+{
+    std::vector<int> xs(40);
+    std::iota(xs.begin(), xs.end(), 0);
+
+    auto expected = xs;
+    for(std::size_t i = 0; i != 30; ++ i)
+    {
+        std::swap(expected[i], expected[i + 10]);
+    }
+
+    sayan::swap_ranges(sayan::pointer_cursor_type<int>(xs.data(), xs.data() + 30),
+                       sayan::pointer_cursor_type<int>(xs.data() + 10, xs.data() + 40));
+
+    CHECK(xs == expected);
+}
+
 TEST_CASE("algorithm/reverse_copy: minimal")
 {
     std::list<int> src;
@@ -1449,6 +2056,100 @@ TEST_CASE("algorithm/reverse")
     }
 }
 
+namespace
+{
+    struct reverse_test_pair
+    {
+        std::int64_t first;
+        std::int64_t second;
+
+        friend bool operator==(reverse_test_pair const & x, reverse_test_pair const & y)
+        {
+            return x.first == y.first && x.second == y.second;
+        }
+    };
+}
+
+TEST_CASE("algorithm/reverse: contiguous, trivially copyable")
+{
+    sayan::test::for_each_type<char, std::uint16_t, std::int32_t, float, double, std::int64_t,
+                               reverse_test_pair>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        for(std::size_t n = 0; n != 70; ++ n)
+        {
+            CAPTURE(n);
+
+            std::vector<T> src(n);
+            for(std::size_t i = 0; i != n; ++ i)
+            {
+                std::memset(&src[i], static_cast<int>(i * 7 + 1), sizeof(T));
+                reinterpret_cast<unsigned char *>(&src[i])[0] = static_cast<unsigned char>(i);
+            }
+
+            auto expected = src;
+            std::reverse(expected.begin(), expected.end());
+
+            auto xs = src;
+            sayan::reverse(xs);
+
+            CHECK(xs == expected);
+
+            std::vector<T> out(n + 3, src.empty() ? T{} : src.front());
+            auto const r = sayan::reverse_copy(src, out);
+
+            CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+            CHECK(r.first.begin() == src.begin());
+            CHECK(r.first.end() == src.begin());
+            CHECK(r.second.begin() == out.begin() + n);
+
+            if(n > 5)
+            {
+                std::vector<T> shorter(n - 5);
+                auto const r_short = sayan::reverse_copy(src, shorter);
+
+                CHECK(std::equal(shorter.begin(), shorter.end(), expected.begin()));
+                CHECK(r_short.first.end() == src.begin() + 5);
+                CHECK(!r_short.second);
+            }
+        }
+    });
+}
+
+TEST_CASE("algorithm/reverse_copy: contiguous, overlapping output")
+{
+    std::vector<int> src(40);
+    std::iota(src.begin(), src.end(), 0);
+
+    for(std::ptrdiff_t shift : {-10, -1, 0, 1, 10})
+    {
+        CAPTURE(shift);
+
+        std::vector<int> buffer(60, -1);
+        std::copy(src.begin(), src.end(), buffer.begin() + 10);
+
+        auto expected = buffer;
+        {
+            auto const in = expected.data() + 10;
+            auto const out = in + shift;
+
+            for(std::size_t i = 0; i != src.size(); ++ i)
+            {
+                out[i] = in[src.size() - 1 - i];
+            }
+        }
+
+        auto const in = sayan::pointer_cursor_type<int>(buffer.data() + 10, buffer.data() + 50);
+        auto const out = sayan::pointer_cursor_type<int>(buffer.data() + 10 + shift,
+                                                         buffer.data() + 50 + shift);
+
+        sayan::reverse_copy(in, out);
+
+        CHECK(buffer == expected);
+    }
+}
+
 TEST_CASE("algorithm/rotate: empty parts")
 {
     std::forward_list<int> xs{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
@@ -1545,6 +2246,40 @@ TEST_CASE("algorithm/rotate: first longer")
     CHECK((xs_sayan.end() - r.end()) == 0);
 }
 
+TEST_CASE("algorithm/rotate: contiguous, trivially copyable")
+{
+    sayan::test::for_each_type<char, std::int32_t, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        for(std::size_t n : {1, 2, 33, 300, 1000})
+        {
+            std::vector<T> src(n);
+            for(std::size_t i = 0; i != n; ++ i)
+            {
+                src[i] = static_cast<T>(i % 97);
+            }
+
+            for(std::size_t d = 0; d <= n; d += (d < 5 || n - d < 5) ? 1 : 37)
+            {
+                CAPTURE(n);
+                CAPTURE(d);
+
+                auto expected = src;
+                auto const r_std = std::rotate(expected.begin(), expected.begin() + d, expected.end());
+
+                auto xs = src;
+                auto const r = sayan::rotate(sayan::next(sayan::cursor(xs), d));
+
+                CHECK(xs == expected);
+                CHECK(r.traversed(sayan::front).begin() == xs.begin());
+                CHECK(r.begin() - xs.begin() == r_std - expected.begin());
+                CHECK(r.end() == xs.end());
+            }
+        }
+    });
+}
+
 TEST_CASE("algorithm/rotate_copy")
 {
     // Настройки
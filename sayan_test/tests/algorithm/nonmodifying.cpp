@@ -2,10 +2,15 @@
 
 #include <sayan/cursor/istream.hpp>
 
+#include "../../simple_test.hpp"
 #include <catch/catch.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <forward_list>
+#include <functional>
+#include <limits>
+#include <vector>
 
 TEST_CASE("algorithms/nonmodifying/quantors: all_of, any_of, some_of")
 {
@@ -177,6 +182,166 @@ TEST_CASE("algorithms/nonmodifying/find: fail, auto-cursor")
     CHECK(r.empty());
 }
 
+TEST_CASE("algorithm/find_with_sentinel")
+{
+    std::vector<int> const src{3, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+    auto const pred = [](int x, int y) { return x == y; };
+
+    for(auto value : {3, 1, 9, 6, 42})
+    {
+        auto xs = src;
+
+        auto const r_std = std::find(xs.begin(), xs.end(), value);
+        auto const r = sayan::find_with_sentinel(xs, value, pred);
+
+        CHECK(xs == src);
+
+        CHECK(r.traversed_begin() == xs.begin());
+        CHECK(r.begin() == r_std);
+        CHECK(r.end() == xs.end());
+
+        auto const r_const = sayan::find_with_sentinel(src, value, pred);
+
+        CHECK(r_const.begin() - src.begin() == r_std - xs.begin());
+    }
+}
+
+TEST_CASE("algorithm/find_with_sentinel: last element and empty sequence")
+{
+    std::vector<int> xs{3, 1, 4, 1, 5};
+    auto const pred = [](int x, int y) { return x == y; };
+
+    CHECK(sayan::find_with_sentinel(xs, 5, pred).begin() == xs.end() - 1);
+    CHECK(xs.back() == 5);
+
+    std::vector<int> empty;
+    CHECK(!sayan::find_with_sentinel(empty, 5, pred));
+}
+
+TEST_CASE("algorithm/find: mutable contiguous, last element")
+{
+    std::vector<int> xs{3, 1, 4, 1, 5};
+
+    auto const r = sayan::find(xs, 5);
+
+    CHECK(r.begin() == xs.end() - 1);
+    CHECK(xs.back() == 5);
+}
+
+TEST_CASE("algorithm/find: mutable contiguous, value is not representable")
+{
+    std::vector<unsigned char> xs{1, 2, 44, 3};
+
+    auto const r = sayan::find(xs, 300);
+
+    CHECK(r.begin() == xs.end());
+    CHECK(xs.back() == 3);
+}
+
+TEST_CASE("algorithm/find: mutable contiguous, custom predicate")
+{
+    std::vector<int> xs{3, 1, 4, 1, 5, 9, 2, 6};
+    auto const pred = [](int x, int y) { return x > y; };
+
+    auto const r = sayan::find(xs, 4, pred);
+
+    CHECK(r.begin() == xs.begin() + 4);
+
+    auto const r_fail = sayan::find(xs, 9, pred);
+
+    CHECK(r_fail.begin() == xs.end());
+    CHECK(xs.back() == 6);
+}
+
+TEST_CASE("algorithm/find: contiguous arithmetic, every position")
+{
+    sayan::test::for_each_type<char, std::uint8_t, std::int16_t, std::int32_t, std::uint32_t,
+                               float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+        using L = std::numeric_limits<T>;
+
+        auto const absent = T(1);
+
+        for(auto const present : {L::max(), L::lowest()})
+        {
+            CAPTURE(present);
+
+            // Длина не кратна размеру блока, чтобы проверить обработку хвоста
+            for(std::size_t n : {0, 1, 7, 16, 67, 130})
+            {
+                CAPTURE(n);
+
+                std::vector<T> xs(n, absent);
+                std::vector<T> const & cxs = xs;
+
+                CHECK(sayan::find(xs, present).begin() == xs.end());
+                CHECK(sayan::find(cxs, present).begin() == cxs.end());
+
+                for(std::size_t i = 0; i != n; ++ i)
+                {
+                    CAPTURE(i);
+
+                    xs[i] = present;
+
+                    if(i + 3 < n)
+                    {
+                        xs[i + 3] = present;
+                    }
+
+                    CHECK(sayan::find(xs, present).begin() == xs.begin() + i);
+                    CHECK(sayan::find(cxs, present).begin() == cxs.begin() + i);
+
+                    std::fill(xs.begin(), xs.end(), absent);
+                }
+            }
+        }
+    });
+}
+
+TEST_CASE("algorithm/find: 64-bit integers differ only in one half")
+{
+    std::int64_t const value = (std::int64_t{1} << 32) + 5;
+
+    std::vector<std::int64_t> xs(40, 5);
+    xs[20] = std::int64_t{1} << 32;
+    xs[31] = value;
+
+    CHECK(sayan::find(xs, value).begin() == xs.begin() + 31);
+}
+
+TEST_CASE("algorithm/find: contiguous arithmetic, mixed value types")
+{
+    std::vector<std::int16_t> const xs{1, -1, 2, 44, 3};
+
+    CHECK(sayan::find(xs, -1L).begin() == xs.begin() + 1);
+    CHECK(sayan::find(xs, 44u).begin() == xs.begin() + 3);
+    CHECK(sayan::find(xs, 65536 + 44).begin() == xs.end());
+
+    std::vector<std::uint32_t> const ys{1, 0xFFFFFFFF, 3};
+
+    CHECK(sayan::find(ys, std::int64_t{-1}).begin() == ys.end());
+    CHECK(sayan::find(ys, std::int64_t{0xFFFFFFFF}).begin() == ys.begin() + 1);
+}
+
+TEST_CASE("algorithm/find: contiguous floating point, signed zero and NaN")
+{
+    auto const nan = std::numeric_limits<double>::quiet_NaN();
+
+    std::vector<double> xs(33, 1.0);
+    xs[17] = -0.0;
+    xs[25] = nan;
+
+    CHECK(sayan::find(xs, 0.0).begin() == xs.begin() + 17);
+    CHECK(sayan::find(xs, nan).begin() == xs.end());
+
+    std::vector<float> ys(33, 1.0f);
+    ys[9] = std::numeric_limits<float>::quiet_NaN();
+    ys[21] = 0.0f;
+
+    CHECK(sayan::find(ys, -0.0f).begin() == ys.begin() + 21);
+}
+
 TEST_CASE("algorithms/nonmodifying/find_if_not: success")
 {
     std::string const src{"Alex Stepanov"};
@@ -376,6 +541,79 @@ TEST_CASE("algorithm/adjacent_find: custom predicate, success")
     CHECK(r.end() == xs.end());
 }
 
+TEST_CASE("algorithm/adjacent_find: contiguous")
+{
+    sayan::test::for_each_type<signed char, unsigned char, std::int16_t, std::uint16_t,
+                               std::int32_t, std::uint32_t, std::int64_t, float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        sayan::test::for_each_type<std::equal_to<>, std::not_equal_to<>,
+                                   std::less<>, std::greater<>>([](auto pred_tag)
+        {
+            typename decltype(pred_tag)::type const pred{};
+
+            for(auto n : {0, 1, 2, 3, 15, 16, 17, 33, 64, 70})
+            {
+                CAPTURE(n);
+
+                // Строго возрастающая последовательность без равных соседей
+                std::vector<T> xs(n);
+                for(auto i = 0; i < n; ++ i)
+                {
+                    xs[i] = static_cast<T>(i % 100);
+                }
+
+                for(auto pos = 0; pos + 1 < n; ++ pos)
+                {
+                    CAPTURE(pos);
+
+                    auto ys = xs;
+                    ys[pos + 1] = ys[pos];
+                    if(pos + 2 < n)
+                    {
+                        ys[pos + 2] = static_cast<T>(ys[pos] - 1);
+                    }
+
+                    auto const r_std = std::adjacent_find(ys.begin(), ys.end(), pred);
+                    auto const r = ::sayan::adjacent_find(ys, pred);
+
+                    CHECK(r.begin() == r_std);
+                    CHECK(r.end() == ys.end());
+                }
+
+                auto const r_std = std::adjacent_find(xs.begin(), xs.end(), pred);
+                auto const r = ::sayan::adjacent_find(xs, pred);
+
+                CHECK(r.begin() == r_std);
+                CHECK(r.end() == xs.end());
+            }
+        });
+    });
+}
+
+TEST_CASE("algorithm/adjacent_find: contiguous, unsigned ordering")
+{
+    std::vector<std::uint32_t> xs(40, 1);
+    xs[25] = std::numeric_limits<std::uint32_t>::max();
+
+    auto const r = ::sayan::adjacent_find(xs, std::greater<>{});
+
+    CHECK(r.begin() == xs.begin() + 25);
+}
+
+TEST_CASE("algorithm/adjacent_find: contiguous, NaN")
+{
+    auto const nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> xs(20, nan);
+    xs[13] = 1.0;
+    xs[14] = 1.0;
+
+    CHECK(::sayan::adjacent_find(xs).begin() == xs.begin() + 13);
+    CHECK(::sayan::adjacent_find(xs, std::less<>{}).begin() == xs.end());
+    CHECK(::sayan::adjacent_find(xs, std::not_equal_to<>{}).begin() == xs.begin());
+}
+
 TEST_CASE("algorithm/search")
 {
     std::forward_list<int> const haystack{2,7,1,8,2,8,1,8,2,8,4,6};
@@ -594,6 +832,103 @@ TEST_CASE("algorithms/nonmodifying/count")
     }
 }
 
+TEST_CASE("algorithm/count: contiguous arithmetic")
+{
+    sayan::test::for_each_type<std::int8_t, std::uint8_t, std::int16_t, std::uint16_t,
+                               std::int32_t, std::uint32_t, std::int64_t, float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        auto const value = T(2);
+
+        for(std::size_t n : {0, 1, 15, 16, 33, 1000})
+        {
+            CAPTURE(n);
+
+            std::vector<T> xs(n);
+
+            for(std::size_t i = 0; i != n; ++ i)
+            {
+                xs[i] = static_cast<T>(i * 7 % 5);
+            }
+
+            CHECK(sayan::count(xs, value) == std::count(xs.begin(), xs.end(), value));
+            CHECK(sayan::count(xs, value, std::not_equal_to<>{})
+                  == std::count_if(xs.begin(), xs.end(), [&](T x) { return x != value; }));
+            CHECK(sayan::count(xs, value, std::less<>{})
+                  == std::count_if(xs.begin(), xs.end(), [&](T x) { return x < value; }));
+            CHECK(sayan::count(xs, value, std::greater<>{})
+                  == std::count_if(xs.begin(), xs.end(), [&](T x) { return x > value; }));
+        }
+    });
+}
+
+TEST_CASE("algorithm/count: contiguous, values with the highest bit set")
+{
+    std::vector<std::uint8_t> const xs{0, 1, 127, 128, 200, 255, 255, 3, 130, 129,
+                                       250, 0, 17, 128, 128, 254, 255};
+
+    CHECK(sayan::count(xs, std::uint8_t{128}) == 3);
+    CHECK(sayan::count(xs, std::uint8_t{128}, std::not_equal_to<>{}) == 14);
+    CHECK(sayan::count(xs, std::uint8_t{128}, std::less<>{}) == 6);
+    CHECK(sayan::count(xs, std::uint8_t{128}, std::greater<>{}) == 8);
+
+    std::vector<std::int32_t> const ys{-5, 7, -2147483647 - 1, 2147483647, 0, -1, 1, 3, -3};
+
+    CHECK(sayan::count(ys, std::int32_t{-1}) == 1);
+    CHECK(sayan::count(ys, std::int32_t{-1}, std::less<>{}) == 3);
+    CHECK(sayan::count(ys, std::int32_t{-1}, std::greater<>{}) == 5);
+
+    CHECK(sayan::count(ys, std::int32_t{-2147483647 - 1}) == 1);
+    CHECK(sayan::count(ys, std::int32_t{-2147483647 - 1}, std::less<>{}) == 0);
+    CHECK(sayan::count(ys, std::int32_t{-2147483647 - 1}, std::greater<>{}) == 8);
+
+    std::vector<std::uint32_t> const zs{0, 0xFFFFFFFF, 0x80000000, 0x7FFFFFFF, 5, 6, 7, 8, 9};
+
+    CHECK(sayan::count(zs, std::uint32_t{0x80000000}) == 1);
+    CHECK(sayan::count(zs, std::uint32_t{0x80000000}, std::not_equal_to<>{}) == 8);
+    CHECK(sayan::count(zs, std::uint32_t{0x80000000}, std::less<>{}) == 7);
+    CHECK(sayan::count(zs, std::uint32_t{0x80000000}, std::greater<>{}) == 1);
+}
+
+TEST_CASE("algorithm/count: contiguous, counts exceed lane capacity")
+{
+    // Более 255 совпадений в каждом байтовом счётчике
+    std::vector<char> xs(100003, 'x');
+    xs[500] = 'y';
+
+    CHECK(sayan::count(xs, 'x') == 100002);
+    CHECK(sayan::count(xs, 'y') == 1);
+    CHECK(sayan::count(xs, 'x', std::not_equal_to<>{}) == 1);
+
+    std::vector<std::uint16_t> ys(16 * 65536 + 9, 1);
+
+    CHECK(sayan::count(ys, std::uint16_t{1}) == static_cast<std::ptrdiff_t>(ys.size()));
+    CHECK(sayan::count(ys, std::uint16_t{2}, std::less<>{}) == static_cast<std::ptrdiff_t>(ys.size()));
+}
+
+TEST_CASE("algorithm/count: contiguous, mixed value types and NaN")
+{
+    std::vector<std::uint8_t> const xs(40, 44);
+
+    CHECK(sayan::count(xs, 44L) == 40);
+    CHECK(sayan::count(xs, 256 + 44) == 0);
+    CHECK(sayan::count(xs, 256 + 44, std::not_equal_to<>{}) == 40);
+
+    auto const nan = std::numeric_limits<double>::quiet_NaN();
+
+    std::vector<double> ys(21, 1.0);
+    ys[3] = nan;
+    ys[10] = nan;
+    ys[19] = -0.0;
+
+    CHECK(sayan::count(ys, nan) == 0);
+    CHECK(sayan::count(ys, nan, std::not_equal_to<>{}) == 21);
+    CHECK(sayan::count(ys, 0.0) == 1);
+    CHECK(sayan::count(ys, 2.0, std::less<>{}) == 19);
+    CHECK(sayan::count(ys, 0.5, std::greater<>{}) == 18);
+}
+
 TEST_CASE("regression #29: cursor() is ambigeous for cursors")
 {
     std::string const s{};
@@ -754,6 +1089,78 @@ TEST_CASE("algorithm/mismatch: forward")
     CHECK(r.second.end() == xs2.end());
 }
 
+TEST_CASE("algorithm/mismatch, equal, lexicographical_compare: contiguous integers")
+{
+    sayan::test::for_each_type<unsigned char, signed char, char,
+                               std::int16_t, std::uint32_t, std::int64_t>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+        using L = std::numeric_limits<T>;
+
+        auto const x = T(1);
+
+        // Значение, которое больше x, но меньше его в первом байте
+        auto const high_byte = static_cast<T>(sizeof(T) == 1 ? 2 : 256);
+
+        for(auto const y : {L::max(), L::lowest(), T(0), high_byte})
+        {
+            for(std::size_t n : {0, 1, 15, 16, 17, 64, 100, 131})
+            {
+                CAPTURE(n);
+
+                std::vector<T> const xs(n, x);
+
+                std::vector<std::vector<T>> yss{xs, std::vector<T>(n == 0 ? 0 : n - 1, x)};
+
+                for(std::size_t i = 0; i != n; ++ i)
+                {
+                    auto ys = xs;
+                    ys[i] = y;
+                    yss.push_back(ys);
+
+                    ys.resize(n + 5, x);
+                    yss.push_back(ys);
+                }
+
+                for(auto const & ys : yss)
+                {
+                    CAPTURE(ys.size());
+
+                    auto const r_std = std::mismatch(xs.begin(), xs.end(), ys.begin(), ys.end());
+                    auto const r = sayan::mismatch(xs, ys);
+
+                    CHECK(r.first.traversed_begin() == xs.begin());
+                    CHECK(r.first.begin() == r_std.first);
+                    CHECK(r.first.end() == xs.end());
+
+                    CHECK(r.second.traversed_begin() == ys.begin());
+                    CHECK(r.second.begin() == r_std.second);
+                    CHECK(r.second.end() == ys.end());
+
+                    CHECK(sayan::equal(xs, ys) == (xs == ys));
+                    CHECK(sayan::lexicographical_compare(xs, ys)
+                          == std::lexicographical_compare(xs.begin(), xs.end(), ys.begin(), ys.end()));
+                    CHECK(sayan::lexicographical_compare(ys, xs)
+                          == std::lexicographical_compare(ys.begin(), ys.end(), xs.begin(), xs.end()));
+                }
+            }
+        }
+    });
+}
+
+TEST_CASE("algorithm/equal: different sizes")
+{
+    std::vector<int> const xs{1, 2, 3};
+    std::vector<int> const ys{1, 2, 3, 4};
+
+    auto calls = 0;
+    auto const pred = [&calls](int x, int y) { ++ calls; return x == y; };
+
+    CHECK(!sayan::equal(xs, ys, pred));
+    CHECK(calls == 0);
+    CHECK(sayan::equal(xs, xs, pred));
+}
+
 TEST_CASE("algorithms/is_partitioned")
 {
     std::vector<std::string> const strs{"", "generic", "AlexStepanov", "STL",
@@ -5,7 +5,10 @@
 #include <catch/catch.hpp>
 #include "../../simple_test.hpp"
 
+#include <cstdint>
 #include <forward_list>
+#include <limits>
+#include <vector>
 
 TEST_CASE("algorithm/is_sorted")
 {
@@ -77,6 +80,52 @@ TEST_CASE("algorithm/is_sorted_until: custom compare, fail")
     CHECK(r.end() == xs.end());
 }
 
+TEST_CASE("algorithm/is_sorted_until: contiguous")
+{
+    for(auto n : {0, 1, 2, 17, 64, 100})
+    {
+        std::vector<std::int16_t> xs(n);
+        for(auto i = 0; i < n; ++ i)
+        {
+            xs[i] = static_cast<std::int16_t>(i / 3 - 10);
+        }
+
+        for(auto pos = 1; pos < n; ++ pos)
+        {
+            auto ys = xs;
+            ys[pos] = static_cast<std::int16_t>(ys[pos - 1] - 1);
+
+            auto const r = ::sayan::is_sorted_until(ys);
+            CHECK(r.begin() == std::is_sorted_until(ys.begin(), ys.end()));
+
+            std::reverse(ys.begin(), ys.end());
+            auto const r_greater = ::sayan::is_sorted_until(ys, std::greater<>{});
+            CHECK(r_greater.begin()
+                  == std::is_sorted_until(ys.begin(), ys.end(), std::greater<>{}));
+        }
+
+        CHECK(::sayan::is_sorted(xs));
+    }
+}
+
+TEST_CASE("algorithm/is_sorted_until: contiguous, floating point")
+{
+    auto const nan = std::numeric_limits<float>::quiet_NaN();
+
+    std::vector<float> xs(50);
+    for(std::size_t i = 0; i < xs.size(); ++ i)
+    {
+        xs[i] = static_cast<float>(i) / 4;
+    }
+    xs[20] = nan;
+    xs[40] = -1.0f;
+
+    auto const r = ::sayan::is_sorted_until(xs);
+
+    CHECK(r.begin() == std::is_sorted_until(xs.begin(), xs.end()));
+    CHECK(r.begin() == xs.begin() + 40);
+}
+
 TEST_CASE("algorithm/lower_bound")
 {
     std::forward_list<int> const xs{2, 3, 3, 4, 4, 4, 6, 7};
@@ -255,6 +304,25 @@ TEST_CASE("algorithm/inplace_merge")
     }
 }
 
+TEST_CASE("algorithm/inplace_merge: contiguous, large parts")
+{
+    std::vector<int> xs(2000);
+    for(std::size_t i = 0; i != xs.size(); ++ i)
+    {
+        xs[i] = static_cast<int>(i < 1200 ? i * 3 % 1200 : (i - 1200) * 7 % 800);
+    }
+
+    std::sort(xs.begin(), xs.begin() + 1200);
+    std::sort(xs.begin() + 1200, xs.end());
+
+    auto expected = xs;
+    std::sort(expected.begin(), expected.end());
+
+    sayan::inplace_merge(sayan::next(sayan::cursor(xs), 1200));
+
+    CHECK(xs == expected);
+}
+
 TEST_CASE("algorithm/inplace_merge: custom compare")
 {
     std::vector<int> xs;
@@ -0,0 +1,74 @@
+#include <sayan/cursor/c_str.hpp>
+
+#include <sayan/algorithm.hpp>
+
+#include <cstring>
+#include <string>
+
+#include <catch/catch.hpp>
+
+TEST_CASE("cursors/c_str: traversal")
+{
+    char const * const src = "Alexander Stepanov";
+
+    std::string result;
+
+    auto cur = sayan::c_str_cursor(src);
+
+    for(; !cur.empty(); cur.drop(sayan::front))
+    {
+        result.push_back(cur[sayan::front]);
+    }
+
+    CHECK(result == src);
+
+    CHECK(cur.begin() == src + std::strlen(src));
+    CHECK(cur.traversed_begin() == src);
+
+    CHECK_THROWS(cur[sayan::front]);
+    CHECK_THROWS(cur.drop(sayan::front));
+}
+
+TEST_CASE("cursors/c_str: empty string")
+{
+    auto const cur = sayan::c_str_cursor("");
+
+    CHECK(!cur);
+    CHECK(sayan::size(cur) == 0);
+}
+
+TEST_CASE("cursors/c_str: find")
+{
+    char const * const src = "Alexander Stepanov";
+
+    auto const r = sayan::find(sayan::c_str_cursor(src), 'S');
+
+    CHECK(r.traversed_begin() == src);
+    CHECK(r.begin() == std::strchr(src, 'S'));
+
+    auto const r_fail = sayan::find(sayan::c_str_cursor(src), 'z');
+
+    CHECK(!r_fail);
+    CHECK(r_fail.begin() == src + std::strlen(src));
+}
+
+TEST_CASE("cursors/c_str: exhaust")
+{
+    char const * const src = "Bjarne";
+
+    auto cur = sayan::c_str_cursor(src);
+    cur.exhaust(sayan::front);
+
+    CHECK(!cur);
+    CHECK(cur.begin() == src + 6);
+    CHECK(cur.traversed_begin() == src);
+}
+
+TEST_CASE("cursors/c_str: mutable string")
+{
+    char str[] = "generic programming";
+
+    sayan::replace(sayan::c_str_cursor(str), ' ', '_');
+
+    CHECK(std::string(str) == "generic_programming");
+}
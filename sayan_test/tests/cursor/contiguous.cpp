@@ -0,0 +1,121 @@
+#include <sayan/cursor/contiguous.hpp>
+
+#include <sayan/algorithm.hpp>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+TEST_CASE("cursors/contiguous: is_contiguous_iterator")
+{
+    static_assert(sayan::is_contiguous_iterator<int *>::value, "");
+    static_assert(sayan::is_contiguous_iterator<int const *>::value, "");
+    static_assert(sayan::is_contiguous_iterator<std::vector<int>::iterator>::value, "");
+    static_assert(sayan::is_contiguous_iterator<std::vector<int>::const_iterator>::value, "");
+    static_assert(sayan::is_contiguous_iterator<std::string::iterator>::value, "");
+    static_assert(sayan::is_contiguous_iterator<std::string::const_iterator>::value, "");
+    static_assert(sayan::is_contiguous_iterator<std::wstring::iterator>::value, "");
+    static_assert(sayan::is_contiguous_iterator<std::array<double, 3>::iterator>::value, "");
+
+    static_assert(!sayan::is_contiguous_iterator<std::vector<bool>::iterator>::value, "");
+    static_assert(!sayan::is_contiguous_iterator<std::deque<int>::iterator>::value, "");
+    static_assert(!sayan::is_contiguous_iterator<std::list<int>::iterator>::value, "");
+    static_assert(!sayan::is_contiguous_iterator<std::forward_list<int>::iterator>::value, "");
+    static_assert(!sayan::is_contiguous_iterator<std::vector<int>::reverse_iterator>::value, "");
+
+    CHECK(sayan::is_contiguous_iterator<std::vector<int>::iterator>::value);
+    CHECK_FALSE(sayan::is_contiguous_iterator<std::deque<int>::iterator>::value);
+}
+
+TEST_CASE("cursors/contiguous: is_contiguous_cursor")
+{
+    static_assert(sayan::is_contiguous_cursor<sayan::cursor_type_t<std::vector<int> &>>::value, "");
+    static_assert(sayan::is_contiguous_cursor<sayan::cursor_type_t<std::vector<int> const &>>::value, "");
+    static_assert(sayan::is_contiguous_cursor<sayan::cursor_type_t<std::string &>>::value, "");
+    static_assert(sayan::is_contiguous_cursor<sayan::cursor_type_t<std::array<int, 5> &>>::value, "");
+    static_assert(sayan::is_contiguous_cursor<sayan::cursor_type_t<int(&)[5]>>::value, "");
+    static_assert(sayan::is_contiguous_cursor<sayan::pointer_cursor_type<char const>>::value, "");
+
+    static_assert(!sayan::is_contiguous_cursor<sayan::cursor_type_t<std::list<int> &>>::value, "");
+    static_assert(!sayan::is_contiguous_cursor<sayan::cursor_type_t<std::deque<int> &>>::value, "");
+    static_assert(!sayan::is_contiguous_cursor<sayan::cursor_type_t<std::istringstream &>>::value, "");
+
+    using Reverse = decltype(sayan::make_reverse_cursor(std::declval<std::vector<int> &>()));
+    static_assert(!sayan::is_contiguous_cursor<Reverse>::value, "");
+
+    CHECK(sayan::is_contiguous_cursor<sayan::cursor_type_t<std::vector<int> &>>::value);
+    CHECK_FALSE(sayan::is_contiguous_cursor<sayan::cursor_type_t<std::list<int> &>>::value);
+}
+
+TEST_CASE("cursors/contiguous: C array")
+{
+    int xs[] = {3, 1, 4, 1, 5};
+
+    auto cur = sayan::cursor(xs);
+
+    CHECK(cur.begin() == xs + 0);
+    CHECK(cur.end() == xs + 5);
+    CHECK(sayan::size(cur) == 5);
+
+    sayan::fill(xs, 2);
+
+    CHECK(std::count(xs, xs + 5, 2) == 5);
+}
+
+TEST_CASE("cursors/contiguous: cursor_data")
+{
+    std::vector<int> xs{3, 1, 4, 1, 5, 9, 2, 6};
+
+    auto cur = sayan::cursor(xs);
+
+    CHECK(sayan::cursor_data(cur) == xs.data());
+
+    cur += 3;
+
+    CHECK(sayan::cursor_data(cur) == xs.data() + 3);
+
+    cur.exhaust(sayan::front);
+
+    CHECK(sayan::cursor_data(cur) == nullptr);
+}
+
+TEST_CASE("cursors/contiguous: to_pointer_cursor")
+{
+    std::string const src{"Alexander Stepanov"};
+
+    auto cur = sayan::cursor(src);
+    cur += 4;
+
+    auto const p_cur = sayan::to_pointer_cursor(cur);
+
+    static_assert(std::is_same<decltype(p_cur.begin()), char const *>::value, "");
+
+    CHECK(p_cur.begin() == src.data() + 4);
+    CHECK(p_cur.end() == src.data() + src.size());
+    CHECK(p_cur.traversed_begin() == p_cur.begin());
+
+    auto const n = sayan::find(p_cur, ' ').begin() - p_cur.begin();
+
+    cur += n;
+
+    CHECK(cur.traversed_begin() == src.begin());
+    CHECK(cur.begin() == src.begin() + src.find(' '));
+    CHECK(cur.end() == src.end());
+}
+
+TEST_CASE("cursors/contiguous: to_pointer_cursor of empty cursor")
+{
+    std::vector<int> const xs;
+
+    auto const p_cur = sayan::to_pointer_cursor(sayan::cursor(xs));
+
+    CHECK(!p_cur);
+    CHECK(sayan::size(p_cur) == 0);
+}
@@ -0,0 +1,210 @@
+#include <sayan/cursor/counted.hpp>
+#include <sayan/cursor/back_inserter.hpp>
+
+#include <sayan/algorithm.hpp>
+
+#include <forward_list>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+TEST_CASE("cursors/counted: counts elements")
+{
+    std::vector<int> const xs{3, 1, 4, 1, 5, 9, 2, 6};
+
+    auto cur = sayan::counted_cursor(sayan::cursor(xs), 5);
+
+    static_assert(sayan::is_cursor<decltype(cur)>::value, "");
+    static_assert(sayan::is_sized_cursor<decltype(cur)>::value, "");
+    static_assert(sayan::is_contiguous_cursor<decltype(cur)>::value, "");
+
+    CHECK(cur.size() == 5);
+    CHECK(cur.count() == 5);
+    CHECK(*cur == 3);
+    CHECK(cur[2] == 4);
+
+    ++ cur;
+    cur += 3;
+
+    CHECK(cur.size() == 1);
+    CHECK(*cur == 5);
+
+    ++ cur;
+
+    CHECK(!cur);
+    CHECK(cur.traversed_begin() == xs.begin());
+    CHECK(cur.begin() == xs.begin() + 5);
+    CHECK(cur.base().begin() == xs.begin() + 5);
+}
+
+TEST_CASE("cursors/counted: forward base")
+{
+    std::forward_list<int> const xs{3, 1, 4, 1, 5};
+
+    std::vector<int> ys;
+
+    sayan::copy(sayan::counted_cursor(sayan::cursor(xs), 3), sayan::back_inserter(ys));
+
+    CHECK(ys == (std::vector<int>{3, 1, 4}));
+}
+
+TEST_CASE("cursors/counted: copy_n, sized input")
+{
+    std::vector<int> const xs{3, 1, 4, 1, 5, 9, 2, 6};
+    std::vector<int> ys(10, -1);
+
+    auto const r = sayan::copy_n(xs, 5, ys);
+
+    CHECK(r.first.traversed_begin() == xs.begin());
+    CHECK(r.first.begin() == xs.begin() + 5);
+    CHECK(r.second.traversed_begin() == ys.begin());
+    CHECK(r.second.begin() == ys.begin() + 5);
+    CHECK(ys == (std::vector<int>{3, 1, 4, 1, 5, -1, -1, -1, -1, -1}));
+}
+
+TEST_CASE("cursors/counted: copy_n, count exceeds input size")
+{
+    std::vector<int> const xs{3, 1, 4};
+    std::vector<int> ys(5, -1);
+
+    auto const r = sayan::copy_n(xs, 10, ys);
+
+    CHECK(r.first.begin() == xs.end());
+    CHECK(r.second.begin() == ys.begin() + 3);
+    CHECK(ys == (std::vector<int>{3, 1, 4, -1, -1}));
+}
+
+TEST_CASE("cursors/counted: copy_n, count exceeds output size")
+{
+    std::vector<int> const xs{3, 1, 4, 1, 5};
+    std::vector<int> ys(3, -1);
+
+    auto const r = sayan::copy_n(xs, 5, ys);
+
+    CHECK(r.first.begin() == xs.begin() + 3);
+    CHECK(r.second.begin() == ys.end());
+    CHECK(ys == (std::vector<int>{3, 1, 4}));
+}
+
+TEST_CASE("cursors/counted: fill_n and generate_n, sized output")
+{
+    std::vector<int> xs(5, 0);
+
+    auto const r1 = sayan::fill_n(xs, 3, 7);
+
+    CHECK(r1.traversed_begin() == xs.begin());
+    CHECK(r1.begin() == xs.begin() + 3);
+    CHECK(xs == (std::vector<int>{7, 7, 7, 0, 0}));
+
+    auto counter = 0;
+    auto const r2 = sayan::generate_n(xs, 10, [&counter]() { return ++counter; });
+
+    CHECK(r2.begin() == xs.end());
+    CHECK(xs == (std::vector<int>{1, 2, 3, 4, 5}));
+
+    auto const r3 = sayan::fill_n(xs, -1, 0);
+
+    CHECK(r3.begin() == xs.begin());
+    CHECK(xs == (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST_CASE("cursors/counted: fill_n, unsized output")
+{
+    std::list<int> xs(5, 0);
+
+    auto const r = sayan::fill_n(xs, 3, 7);
+
+    CHECK(r.begin() == std::next(xs.begin(), 3));
+    CHECK(xs == (std::list<int>{7, 7, 7, 0, 0}));
+}
+
+TEST_CASE("cursors/counted: unsized base")
+{
+    std::list<int> const xs{3, 1, 4, 1, 5};
+
+    auto cur = sayan::counted_cursor(sayan::cursor(xs), 10);
+
+    static_assert(!sayan::is_sized_cursor<decltype(cur)>::value, "");
+
+    std::vector<int> ys;
+    sayan::copy(cur, sayan::back_inserter(ys));
+
+    CHECK(ys == (std::vector<int>{3, 1, 4, 1, 5}));
+}
+
+TEST_CASE("cursors/counted: traversed, forget and exhaust")
+{
+    std::list<int> const xs{3, 1, 4, 1, 5, 9};
+
+    auto cur = sayan::counted_cursor(sayan::cursor(xs), 4);
+
+    ++ cur;
+    ++ cur;
+
+    auto const t = cur.traversed(sayan::front);
+
+    CHECK(t.count() == 2);
+    CHECK(t.begin() == xs.begin());
+    CHECK(t.base().end() == std::next(xs.begin(), 2));
+
+    cur.forget(sayan::front);
+
+    CHECK(cur.traversed(sayan::front).count() == 0);
+    CHECK(cur.traversed_begin() == std::next(xs.begin(), 2));
+
+    cur.exhaust(sayan::front);
+
+    CHECK(!cur);
+    CHECK(cur.count() == 0);
+    CHECK(cur.begin() == std::next(xs.begin(), 4));
+
+    auto v = sayan::counted_cursor(sayan::cursor(std::vector<int>(5)), 3);
+    v.exhaust(sayan::front);
+
+    CHECK(!v);
+    CHECK(v.base().size() == 2);
+}
+
+TEST_CASE("cursors/counted: copy_n, unsized input")
+{
+    std::istringstream is("31415");
+    std::string ys(5, '*');
+
+    auto const r = sayan::copy_n(is, 3, ys);
+
+    CHECK(r.second.begin() == ys.begin() + 3);
+    CHECK(ys == "314**");
+
+    std::list<int> const xs{2, 7};
+    std::vector<int> zs(5, -1);
+
+    auto const r2 = sayan::copy_n(xs, 10, zs);
+
+    CHECK(r2.first.begin() == xs.end());
+    CHECK(r2.second.begin() == zs.begin() + 2);
+    CHECK(zs == (std::vector<int>{2, 7, -1, -1, -1}));
+
+    auto const r3 = sayan::copy_n(xs, -1, zs);
+
+    CHECK(r3.first.begin() == xs.begin());
+    CHECK(r3.second.begin() == zs.begin());
+}
+
+TEST_CASE("cursors/counted: generate_n and fill_n, unsized output")
+{
+    std::list<int> xs(3, 0);
+
+    auto counter = 0;
+    auto const r = sayan::generate_n(xs, 5, [&counter]() { return ++counter; });
+
+    CHECK(r.begin() == xs.end());
+    CHECK(xs == (std::list<int>{1, 2, 3}));
+
+    std::vector<int> ys;
+    sayan::fill_n(sayan::back_inserter(ys), 2, 9);
+
+    CHECK(ys == (std::vector<int>{9, 9}));
+}
@@ -0,0 +1,63 @@
+#include <sayan/cursor/enumerate.hpp>
+
+#include <sayan/algorithm.hpp>
+
+#include <list>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+TEST_CASE("cursors/enumerate: forward base")
+{
+    std::list<char> const xs{'a', 'b', 'c'};
+
+    auto cur = sayan::enumerate_cursor(xs);
+
+    static_assert(sayan::is_cursor<decltype(cur)>::value, "");
+
+    REQUIRE(!!cur);
+    CHECK((*cur).first == 0);
+    CHECK((*cur).second == 'a');
+
+    ++ cur;
+    ++ cur;
+
+    CHECK(cur.index() == 2);
+    CHECK((*cur).second == 'c');
+
+    auto const t = cur.traversed(sayan::front);
+    CHECK(t.index() == 0);
+    CHECK((*t).second == 'a');
+}
+
+TEST_CASE("cursors/enumerate: random access")
+{
+    std::vector<int> xs{3, 1, 4, 1, 5};
+
+    auto cur = sayan::enumerate_cursor(xs);
+
+    static_assert(sayan::is_sized_cursor<decltype(cur)>::value, "");
+
+    cur += 2;
+
+    CHECK(cur.size() == 3);
+    CHECK(cur[1].first == 3);
+    CHECK(cur[1].second == 1);
+    CHECK(cur[sayan::back].first == 4);
+    CHECK(cur[sayan::back].second == 5);
+
+    (*cur).second = 7;
+    CHECK(xs[2] == 7);
+}
+
+TEST_CASE("cursors/enumerate: find_if by index")
+{
+    std::vector<int> const xs{3, 1, 4, 1, 5};
+
+    auto const r = sayan::find_if(sayan::enumerate_cursor(xs),
+                                  [](auto const & p) { return p.first == p.second; });
+
+    REQUIRE(!!r);
+    CHECK(r.index() == 1);
+    CHECK(r.base().begin() == xs.begin() + 1);
+}
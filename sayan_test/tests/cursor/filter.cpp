@@ -0,0 +1,70 @@
+#include <sayan/cursor/filter.hpp>
+
+#include <sayan/algorithm.hpp>
+#include <sayan/cursor/back_inserter.hpp>
+
+#include <forward_list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+TEST_CASE("cursors/filter: skips elements")
+{
+    std::forward_list<int> const xs{2, 3, 1, 4, 1, 5, 9, 2, 6};
+
+    auto const is_odd = [](int x) { return x % 2 != 0; };
+
+    auto cur = sayan::filter_cursor(xs, is_odd);
+
+    static_assert(sayan::is_cursor<decltype(cur)>::value, "");
+
+    REQUIRE(!!cur);
+    CHECK(*cur == 3);
+    CHECK(cur.base().begin() == std::next(xs.begin()));
+
+    std::vector<int> ys;
+    sayan::copy(cur, sayan::back_inserter(ys));
+
+    CHECK(ys == (std::vector<int>{3, 1, 1, 5, 9}));
+}
+
+TEST_CASE("cursors/filter: no matching elements")
+{
+    std::vector<int> const xs{2, 4, 6};
+
+    auto const cur = sayan::filter_cursor(xs, [](int x) { return x < 0; });
+
+    CHECK(!cur);
+    CHECK(cur.base().begin() == xs.end());
+}
+
+TEST_CASE("cursors/filter: forward algorithms")
+{
+    std::vector<int> xs{5, 2, 8, 3, 6, 1};
+
+    auto const is_even = [](int x) { return x % 2 == 0; };
+
+    auto const r = sayan::min_element(sayan::filter_cursor(xs, is_even));
+
+    REQUIRE(!!r);
+    CHECK(*r == 2);
+    CHECK(r.base().begin() == xs.begin() + 1);
+
+    sayan::fill(sayan::filter_cursor(xs, is_even), 0);
+
+    CHECK(xs == (std::vector<int>{5, 0, 0, 3, 0, 1}));
+}
+
+TEST_CASE("cursors/filter: input base")
+{
+    std::istringstream is("a1b22c3");
+
+    auto const is_digit = [](char c) { return '0' <= c && c <= '9'; };
+
+    std::string ys;
+    sayan::copy(sayan::filter_cursor(is, is_digit), sayan::back_inserter(ys));
+
+    CHECK(ys == "1223");
+}
@@ -2,6 +2,8 @@
 
 #include <sayan/algorithm.hpp>
 
+#include <memory>
+
 #include <catch/catch.hpp>
 
 #include "../../simple_test.hpp"
@@ -0,0 +1,233 @@
+#include <sayan/cursor/segmented.hpp>
+
+#include <sayan/algorithm.hpp>
+#include <sayan/numeric.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <numeric>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+namespace
+{
+    // Дек, состоящий из нескольких блоков, первый из которых заполнен не полностью
+    std::deque<int> make_segmented_deque(int n)
+    {
+        std::deque<int> xs;
+
+        for(auto i = 0; i < n + 37; ++ i)
+        {
+            xs.push_back(i % 17);
+        }
+
+        for(auto i = 0; i < 37; ++ i)
+        {
+            xs.pop_front();
+        }
+
+        return xs;
+    }
+}
+
+TEST_CASE("cursors/segmented: traits")
+{
+    // Итераторы std::deque сегментированы только в libstdc++
+#if defined(__GLIBCXX__)
+    static_assert(sayan::is_segmented_cursor<sayan::cursor_type_t<std::deque<int> &>>::value, "");
+    static_assert(sayan::is_segmented_cursor<sayan::cursor_type_t<std::deque<int> const &>>::value, "");
+#else
+    static_assert(!sayan::is_segmented_cursor<sayan::cursor_type_t<std::deque<int> &>>::value, "");
+#endif
+    static_assert(!sayan::is_segmented_cursor<sayan::cursor_type_t<std::vector<int> &>>::value, "");
+    static_assert(!sayan::is_segmented_cursor<sayan::pointer_cursor_type<int>>::value, "");
+
+    CHECK_FALSE(sayan::is_segmented_cursor<sayan::cursor_type_t<std::vector<int> &>>::value);
+}
+
+// Разбиение std::deque на сегменты доступно только с libstdc++
+#if defined(__GLIBCXX__)
+TEST_CASE("cursors/segmented: segments cover sequence")
+{
+    auto const xs = make_segmented_deque(1000);
+
+    auto cur = sayan::cursor(xs);
+    cur += 5;
+    cur.drop(sayan::back);
+
+    std::vector<int const *> addresses;
+
+    auto segments_count = 0;
+
+    for(auto s = sayan::segments(cur); !!s; ++ s)
+    {
+        auto const seg = *s;
+
+        CHECK(!!seg);
+
+        for(auto p = seg.begin(); p != seg.end(); ++ p)
+        {
+            addresses.push_back(p);
+        }
+
+        ++ segments_count;
+    }
+
+    REQUIRE(addresses.size() == xs.size() - 6);
+
+    CHECK(segments_count > 1);
+
+    for(auto i = 0*addresses.size(); i != addresses.size(); ++ i)
+    {
+        CHECK(addresses[i] == &xs[i+5]);
+    }
+}
+
+TEST_CASE("cursors/segmented: segments of empty cursor")
+{
+    std::deque<int> const xs;
+
+    CHECK(!sayan::segments(sayan::cursor(xs)));
+}
+#endif
+
+// Остальные проверки не зависят от стандартной библиотеки: без специализации
+// для std::deque алгоритмы проходят его поэлементно
+TEST_CASE("cursors/segmented: for_each")
+{
+    auto const xs = make_segmented_deque(1000);
+
+    std::vector<int> ys;
+
+    auto const r = sayan::for_each(xs, [&ys](int x) { ys.push_back(x); });
+
+    CHECK(std::equal(ys.begin(), ys.end(), xs.begin(), xs.end()));
+
+    CHECK(r.traversed_begin() == xs.begin());
+    CHECK(r.begin() == xs.end());
+    CHECK(r.end() == xs.end());
+}
+
+TEST_CASE("cursors/segmented: fill")
+{
+    auto xs = make_segmented_deque(1000);
+
+    auto cur = sayan::cursor(xs);
+    cur += 100;
+    cur.drop(sayan::back);
+
+    sayan::fill(cur, 42);
+
+    CHECK(std::count(xs.begin(), xs.end(), 42) == xs.size() - 101);
+    CHECK(std::count(xs.begin() + 100, xs.end() - 1, 42) == xs.size() - 101);
+}
+
+TEST_CASE("cursors/segmented: find")
+{
+    auto xs = make_segmented_deque(1000);
+    xs[700] = 42;
+    xs[800] = 42;
+
+    auto const r = sayan::find(xs, 42);
+
+    CHECK(r.traversed_begin() == xs.begin());
+    CHECK(r.begin() == xs.begin() + 700);
+    CHECK(r.end() == xs.end());
+
+    auto const r_none = sayan::find(xs, -1);
+
+    CHECK(r_none.traversed_begin() == xs.begin());
+    CHECK(r_none.begin() == xs.end());
+    CHECK(r_none.end() == xs.end());
+}
+
+TEST_CASE("cursors/segmented: count")
+{
+    auto const xs = make_segmented_deque(1000);
+
+    for(auto x : {0, 5, 16, 17})
+    {
+        CHECK(sayan::count(xs, x) == std::count(xs.begin(), xs.end(), x));
+    }
+}
+
+TEST_CASE("cursors/segmented: accumulate")
+{
+    auto const xs = make_segmented_deque(1000);
+
+    auto const r_std = std::accumulate(xs.begin(), xs.end(), 13);
+    auto const r = sayan::accumulate(xs, 13);
+
+    CHECK(r == r_std);
+}
+
+TEST_CASE("cursors/segmented: copy from deque")
+{
+    auto const xs = make_segmented_deque(1000);
+
+    std::vector<int> ys(xs.size() + 10, -1);
+
+    auto const r = sayan::copy(xs, ys);
+
+    CHECK(std::equal(xs.begin(), xs.end(), ys.begin()));
+    CHECK(std::count(ys.begin(), ys.end(), -1) == 10);
+
+    CHECK(r.first.traversed_begin() == xs.begin());
+    CHECK(r.first.begin() == xs.end());
+
+    CHECK(r.second.traversed_begin() == ys.begin());
+    CHECK(r.second.begin() == ys.begin() + xs.size());
+    CHECK(r.second.end() == ys.end());
+}
+
+TEST_CASE("cursors/segmented: copy from deque, output is shorter")
+{
+    auto const xs = make_segmented_deque(1000);
+
+    std::vector<int> ys(xs.size() / 2 + 3, -1);
+
+    auto const r = sayan::copy(xs, ys);
+
+    CHECK(std::equal(ys.begin(), ys.end(), xs.begin()));
+
+    CHECK(r.first.traversed_begin() == xs.begin());
+    CHECK(r.first.begin() == xs.begin() + ys.size());
+    CHECK(r.first.end() == xs.end());
+
+    CHECK(r.second.begin() == ys.end());
+}
+
+TEST_CASE("cursors/segmented: copy to deque")
+{
+    std::vector<int> xs(600);
+    std::iota(xs.begin(), xs.end(), 0);
+
+    auto ys = make_segmented_deque(1000);
+
+    auto const r = sayan::copy(xs, ys);
+
+    CHECK(std::equal(xs.begin(), xs.end(), ys.begin()));
+
+    CHECK(r.first.begin() == xs.end());
+
+    CHECK(r.second.traversed_begin() == ys.begin());
+    CHECK(r.second.begin() == ys.begin() + xs.size());
+    CHECK(r.second.end() == ys.end());
+}
+
+TEST_CASE("cursors/segmented: copy deque to deque")
+{
+    auto xs = make_segmented_deque(1000);
+    std::iota(xs.begin(), xs.end(), 0);
+
+    std::deque<int> ys(700, -1);
+
+    auto const r = sayan::copy(xs, ys);
+
+    CHECK(std::equal(ys.begin(), ys.end(), xs.begin()));
+
+    CHECK(r.first.begin() == xs.begin() + ys.size());
+    CHECK(r.second.traversed_begin() == ys.begin());
+    CHECK(r.second.begin() == ys.end());
+}
@@ -0,0 +1,310 @@
+#include <sayan/cursor/strided.hpp>
+
+#include <sayan/algorithm.hpp>
+#include <sayan/numeric.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "../../simple_test.hpp"
+#include <catch/catch.hpp>
+
+namespace
+{
+    // Матрица 4x3, хранящаяся по строкам: элемент (i, j) равен 10 * i + j
+    std::vector<int> make_matrix()
+    {
+        return {0, 1, 2,
+                10, 11, 12,
+                20, 21, 22,
+                30, 31, 32};
+    }
+
+    /* Матрица из rows строк и трёх столбцов с целыми значениями от 0 до 100:
+    в столбцах длиннее блока, который алгоритмы копируют в буфер, результаты
+    с изменённым порядком вычислений совпадают с последовательными
+    */
+    template <class T>
+    std::vector<T> make_long_matrix(std::ptrdiff_t rows)
+    {
+        std::vector<T> result;
+
+        for(std::ptrdiff_t i = 0; i != 3 * rows; ++ i)
+        {
+            result.push_back(static_cast<T>((i * 37 + i / 3 * 11) % 101));
+        }
+
+        return result;
+    }
+
+    // Номер наименьшего элемента, вычисленный последовательно
+    template <class Cursor>
+    std::ptrdiff_t min_index(Cursor cur)
+    {
+        std::ptrdiff_t result = 0;
+
+        for(std::ptrdiff_t i = 1; i != cur.size(); ++ i)
+        {
+            if(cur[i] < cur[result])
+            {
+                result = i;
+            }
+        }
+
+        return result;
+    }
+
+    // Номер последнего из наибольших элементов, вычисленный последовательно
+    template <class Cursor>
+    std::ptrdiff_t max_index(Cursor cur)
+    {
+        std::ptrdiff_t result = 0;
+
+        for(std::ptrdiff_t i = 1; i != cur.size(); ++ i)
+        {
+            if(!(cur[i] < cur[result]))
+            {
+                result = i;
+            }
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("cursors/strided: column of a matrix")
+{
+    auto const xs = make_matrix();
+
+    auto cur = sayan::strided_cursor(xs.data() + 1, 3, 4);
+
+    static_assert(sayan::is_cursor<decltype(cur)>::value, "");
+    static_assert(sayan::is_sized_cursor<decltype(cur)>::value, "");
+    static_assert(sayan::is_strided_cursor<decltype(cur)>::value, "");
+    static_assert(std::is_same<sayan::cursor_layout_t<decltype(cur)>,
+                               sayan::strided_layout_tag>::value, "");
+
+    REQUIRE(cur.size() == 4);
+    CHECK(cur.stride() == 3);
+    CHECK(*cur == 1);
+    CHECK(cur[2] == 21);
+    CHECK(cur[sayan::back] == 31);
+
+    ++ cur;
+    CHECK(*cur == 11);
+    CHECK(cur.data() == xs.data() + 4);
+
+    cur += 2;
+    CHECK(*cur == 31);
+    CHECK(cur.size() == 1);
+    CHECK(cur.traversed_size() == 3);
+
+    auto const t = cur.traversed(sayan::front);
+    CHECK(t.size() == 3);
+    CHECK(t[0] == 1);
+    CHECK(t[sayan::back] == 21);
+
+    ++ cur;
+    CHECK(!cur);
+}
+
+TEST_CASE("cursors/strided: back")
+{
+    auto const xs = make_matrix();
+
+    auto cur = sayan::strided_cursor(xs.data() + 2, 3, 4);
+
+    cur.drop(sayan::back);
+
+    CHECK(cur.size() == 3);
+    CHECK(cur[sayan::back] == 22);
+
+    auto const t = cur.traversed(sayan::back);
+    REQUIRE(t.size() == 1);
+    CHECK(*t == 32);
+}
+
+TEST_CASE("cursors/strided: accumulate")
+{
+    auto const xs = make_matrix();
+
+    CHECK(sayan::accumulate(sayan::strided_cursor(xs.data(), 3, 4), 0) == 60);
+    CHECK(sayan::accumulate(sayan::strided_cursor(xs.data() + 2, 3, 4), 0) == 68);
+    CHECK(sayan::accumulate(sayan::strided_cursor(xs.data(), 3, 0), 5) == 5);
+}
+
+TEST_CASE("cursors/strided: inner_product")
+{
+    auto const xs = make_matrix();
+    std::vector<int> const ys{1, 2, 3, 4, 5};
+
+    // Столбец на вектор: шаг у одного курсора
+    auto const r1 = sayan::inner_product(sayan::strided_cursor(xs.data() + 1, 3, 4), ys, 0);
+    CHECK(r1 == 1*1 + 11*2 + 21*3 + 31*4);
+
+    // Строка на столбец
+    auto const r2 = sayan::inner_product(sayan::strided_cursor(xs.data() + 3, 1, 3),
+                                         sayan::strided_cursor(xs.data(), 3, 4), 0);
+    CHECK(r2 == 10*0 + 11*10 + 12*20);
+}
+
+TEST_CASE("cursors/strided: min_element and max_element")
+{
+    std::vector<int> const xs{5, 0, 3, 0, 1, 0, 3, 0, 9, 0, 1, 0};
+
+    auto const cur = sayan::strided_cursor(xs.data(), 2, 6);
+
+    auto const r_min = sayan::min_element(cur);
+    REQUIRE(!!r_min);
+    CHECK(*r_min == 1);
+    CHECK(r_min.traversed_size() == 2);
+    CHECK(r_min.data() == xs.data() + 4);
+
+    auto const r_max = sayan::max_element(cur);
+    REQUIRE(!!r_max);
+    CHECK(*r_max == 9);
+    CHECK(r_max.data() == xs.data() + 8);
+
+    // Среди равных min_element возвращает первый, max_element -- последний
+    auto const r_min_last = sayan::min_element(sayan::strided_cursor(xs.data() + 2, 4, 2));
+    CHECK(r_min_last.data() == xs.data() + 2);
+
+    auto const r_max_last = sayan::max_element(sayan::strided_cursor(xs.data() + 2, 4, 2));
+    CHECK(r_max_last.data() == xs.data() + 6);
+
+    CHECK(!sayan::min_element(sayan::strided_cursor(xs.data(), 2, 0)));
+}
+
+TEST_CASE("cursors/strided: transform, column to vector and back")
+{
+    auto xs = make_matrix();
+    std::vector<int> ys(5, -1);
+
+    auto const r1 = sayan::transform(sayan::strided_cursor(xs.data() + 1, 3, 4), ys,
+                                     [](int x) { return 2 * x; });
+
+    CHECK(r1.first.traversed_size() == 4);
+    CHECK(!r1.first);
+    CHECK(r1.second.begin() == ys.begin() + 4);
+    CHECK(ys == (std::vector<int>{2, 22, 42, 62, -1}));
+
+    auto const r2 = sayan::transform(ys, sayan::strided_cursor(xs.data() + 2, 3, 4),
+                                     [](int x) { return x + 1; });
+
+    CHECK(r2.first.begin() == ys.begin() + 4);
+    CHECK(r2.second.traversed_size() == 4);
+    CHECK(xs == (std::vector<int>{0, 1, 3,
+                                  10, 11, 23,
+                                  20, 21, 43,
+                                  30, 31, 63}));
+}
+
+TEST_CASE("cursors/strided: reduce of a long column")
+{
+    sayan::test::for_each_type<int, unsigned char, std::int16_t, std::int64_t, float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        for(auto rows : {3, 255, 256, 257, 1000})
+        {
+            auto const xs = make_long_matrix<T>(rows);
+
+            for(auto column = 0; column != 3; ++ column)
+            {
+                auto const cur = sayan::strided_cursor(xs.data() + column, 3, rows);
+
+                CHECK(sayan::reduce(cur, T(1)) == sayan::accumulate(cur, T(1)));
+            }
+
+            // Единичный шаг: блоки не копируются
+            auto const row = sayan::strided_cursor(xs.data(), 1, rows);
+            CHECK(sayan::reduce(row, T(0)) == sayan::accumulate(row, T(0)));
+        }
+    });
+
+    std::vector<unsigned> const bits{0xF0, 0x3, 0xFF, 0x1, 0x0F, 0x7};
+    CHECK(sayan::reduce(sayan::strided_cursor(bits.data(), 2, 3), 0u, std::bit_or<>{}) == 0xFF);
+    CHECK(sayan::reduce(sayan::strided_cursor(bits.data() + 1, 2, 0), 5u) == 5u);
+}
+
+TEST_CASE("cursors/strided: dot product of long columns")
+{
+    sayan::test::for_each_type<int, unsigned, std::int64_t, float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        for(auto rows : {3, 256, 1000})
+        {
+            auto const xs = make_long_matrix<T>(rows);
+            auto const ys = make_long_matrix<T>(rows + 5);
+
+            auto const col = sayan::strided_cursor(xs.data() + 1, 3, rows);
+            auto const other_col = sayan::strided_cursor(ys.data() + 2, 3, rows + 5);
+
+            T expected_vector(2);
+            T expected_column(2);
+
+            for(std::ptrdiff_t i = 0; i != rows; ++ i)
+            {
+                expected_vector = expected_vector + col[i] * ys[i];
+                expected_column = expected_column + col[i] * other_col[i];
+            }
+
+            CHECK(sayan::inner_product(col, ys, T(2)) == expected_vector);
+            CHECK(sayan::inner_product(ys, col, T(2)) == expected_vector);
+            CHECK(sayan::inner_product(col, other_col, T(2)) == expected_column);
+
+            CHECK(sayan::transform_reduce(col, ys, T(2)) == expected_vector);
+            CHECK(sayan::transform_reduce(ys, col, T(2)) == expected_vector);
+            CHECK(sayan::transform_reduce(col, other_col, T(2)) == expected_column);
+        }
+    });
+}
+
+TEST_CASE("cursors/strided: min_element and max_element of a long column")
+{
+    sayan::test::for_each_type<int, unsigned char, std::int16_t, float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        for(auto rows : {1, 15, 256, 257, 1000})
+        {
+            auto const xs = make_long_matrix<T>(rows);
+
+            for(auto column = 0; column != 3; ++ column)
+            {
+                auto const cur = sayan::strided_cursor(xs.data() + column, 3, rows);
+
+                auto const r_min = sayan::min_element(cur);
+                CHECK(r_min.traversed_size() == min_index(cur));
+                CHECK(r_min.size() == rows - min_index(cur));
+
+                auto const r_max = sayan::max_element(cur);
+                CHECK(r_max.traversed_size() == max_index(cur));
+                CHECK(r_max.size() == rows - max_index(cur));
+            }
+        }
+    });
+}
+
+TEST_CASE("cursors/strided: min_element and max_element with NaN")
+{
+    sayan::test::for_each_type<float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        auto const nan = std::numeric_limits<T>::quiet_NaN();
+
+        for(auto nan_row : {0, 100, 300})
+        {
+            auto xs = make_long_matrix<T>(500);
+            xs[3 * nan_row + 1] = nan;
+
+            auto const cur = sayan::strided_cursor(xs.data() + 1, 3, 500);
+
+            CHECK(sayan::min_element(cur).traversed_size() == min_index(cur));
+            CHECK(sayan::max_element(cur).traversed_size() == max_index(cur));
+        }
+    });
+}
@@ -0,0 +1,59 @@
+#include <sayan/cursor/take_while.hpp>
+
+#include <sayan/algorithm.hpp>
+#include <sayan/cursor/back_inserter.hpp>
+#include <sayan/numeric.hpp>
+
+#include <forward_list>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+TEST_CASE("cursors/take_while: stops at first mismatch")
+{
+    std::forward_list<int> const xs{3, 1, 4, -1, 5, 9};
+
+    auto const is_positive = [](int x) { return x > 0; };
+
+    auto cur = sayan::take_while_cursor(xs, is_positive);
+
+    static_assert(sayan::is_cursor<decltype(cur)>::value, "");
+
+    std::vector<int> ys;
+    sayan::copy(cur, sayan::back_inserter(ys));
+
+    CHECK(ys == (std::vector<int>{3, 1, 4}));
+
+    cur.exhaust(sayan::front);
+
+    CHECK(!cur);
+    CHECK(cur.base().begin() == std::next(xs.begin(), 3));
+
+    auto const t = cur.traversed(sayan::front);
+    CHECK(sayan::accumulate(t, 0) == 8);
+}
+
+TEST_CASE("cursors/take_while: all elements and none")
+{
+    std::vector<int> const xs{3, 1, 4};
+
+    CHECK(sayan::accumulate(sayan::take_while_cursor(xs, [](int) { return true; }), 0) == 8);
+    CHECK(!sayan::take_while_cursor(xs, [](int) { return false; }));
+}
+
+TEST_CASE("cursors/take_while: find")
+{
+    std::vector<int> const xs{3, 1, 4, 0, 5};
+
+    auto const not_zero = [](int x) { return x != 0; };
+
+    auto const r1 = sayan::find(sayan::take_while_cursor(xs, not_zero), 4);
+
+    REQUIRE(!!r1);
+    CHECK(r1.base().begin() == xs.begin() + 2);
+
+    auto const r2 = sayan::find(sayan::take_while_cursor(xs, not_zero), 5);
+
+    CHECK(!r2);
+    CHECK(r2.base().begin() == xs.begin() + 3);
+}
@@ -0,0 +1,77 @@
+#include <sayan/cursor/transform.hpp>
+#include <sayan/cursor/filter.hpp>
+
+#include <sayan/algorithm.hpp>
+#include <sayan/cursor/back_inserter.hpp>
+#include <sayan/numeric.hpp>
+
+#include <forward_list>
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+TEST_CASE("cursors/transform: forward base")
+{
+    std::forward_list<int> const xs{3, 1, 4, 1, 5};
+
+    auto cur = sayan::transform_cursor(xs, [](int x) { return x * x; });
+
+    static_assert(sayan::is_cursor<decltype(cur)>::value, "");
+
+    std::vector<int> ys;
+    sayan::copy(cur, sayan::back_inserter(ys));
+
+    CHECK(ys == (std::vector<int>{9, 1, 16, 1, 25}));
+}
+
+TEST_CASE("cursors/transform: preserves random access")
+{
+    std::vector<int> const xs{3, 1, 4, 1, 5};
+
+    auto cur = sayan::transform_cursor(xs, [](int x) { return 10 * x; });
+
+    static_assert(sayan::is_sized_cursor<decltype(cur)>::value, "");
+
+    CHECK(cur.size() == 5);
+    CHECK(cur[2] == 40);
+    CHECK(cur[sayan::back] == 50);
+
+    cur += 3;
+    CHECK(*cur == 10);
+    CHECK(cur.base().begin() == xs.begin() + 3);
+
+    auto const t = cur.traversed(sayan::front);
+    CHECK(t.size() == 3);
+    CHECK(t[sayan::back] == 40);
+}
+
+TEST_CASE("cursors/transform: algorithms return adapted cursor")
+{
+    std::vector<std::string> const xs{"a", "bb", "ccc", "dd"};
+
+    auto const cur = sayan::transform_cursor(xs, [](std::string const & s) { return s.size(); });
+
+    auto const r = sayan::max_element(cur);
+
+    REQUIRE(!!r);
+    CHECK(*r == 3);
+    CHECK(r.base().begin() == xs.begin() + 2);
+}
+
+TEST_CASE("cursors/transform: single pass pipeline")
+{
+    std::vector<int> const xs{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    auto const is_odd = [](int x) { return x % 2 != 0; };
+    auto const square = [](int x) { return x * x; };
+
+    auto const squares = sayan::transform_cursor(sayan::filter_cursor(xs, is_odd), square);
+
+    CHECK(sayan::accumulate(squares, 0) == 1 + 9 + 25 + 49 + 81);
+
+    std::vector<int> ys;
+    sayan::copy(squares, sayan::back_inserter(ys));
+
+    CHECK(ys == (std::vector<int>{1, 9, 25, 49, 81}));
+}
@@ -0,0 +1,62 @@
+#include <sayan/cursor/unbounded.hpp>
+
+#include <sayan/algorithm.hpp>
+
+#include <forward_list>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+TEST_CASE("cursors/unbounded: is never empty")
+{
+    std::vector<int> const xs{3, 1, 4, 1, 5};
+
+    auto cur = sayan::unbounded_cursor(xs.begin());
+
+    static_assert(sayan::is_cursor<decltype(cur)>::value, "");
+
+    CHECK(!!cur);
+    CHECK(*cur == 3);
+
+    ++ cur;
+    cur += 2;
+
+    CHECK(!!cur);
+    CHECK(*cur == 1);
+    CHECK(cur[1] == 5);
+
+    CHECK(cur.traversed_begin() == xs.begin());
+    CHECK(cur.begin() == xs.begin() + 3);
+}
+
+TEST_CASE("cursors/unbounded: find_if, guaranteed match")
+{
+    std::forward_list<int> const xs{3, 1, 4, 1, 5, 9, 2, 6};
+
+    auto const r = sayan::find_if(sayan::unbounded_cursor(xs.begin()),
+                                  [](int x) { return x > 4; });
+
+    CHECK(r.traversed_begin() == xs.begin());
+    CHECK(r.begin() == std::next(xs.begin(), 4));
+}
+
+TEST_CASE("cursors/unbounded: search_n, guaranteed match")
+{
+    std::vector<int> const xs{1, 2, 2, 1, 2, 2, 2, 3};
+
+    auto const r = sayan::search_n(sayan::unbounded_cursor(xs.begin()), 3, 2);
+
+    CHECK(r.begin() == xs.begin() + 4);
+}
+
+TEST_CASE("cursors/unbounded: copy to bounded")
+{
+    std::vector<int> const xs{3, 1, 4, 1, 5, 9, 2, 6};
+    std::vector<int> ys(5);
+
+    auto const r = sayan::copy(sayan::unbounded_cursor(xs.begin()), ys);
+
+    CHECK(std::equal(ys.begin(), ys.end(), xs.begin()));
+    CHECK(r.first.begin() == xs.begin() + ys.size());
+    CHECK(r.second.begin() == ys.end());
+}
@@ -0,0 +1,265 @@
+#include <sayan/cursor/zip.hpp>
+
+#include <sayan/algorithm.hpp>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+namespace
+{
+    struct key_less
+    {
+        template <class T1, class T2>
+        bool operator()(T1 const & x, T2 const & y) const
+        {
+            return std::get<0>(x) < std::get<0>(y);
+        }
+    };
+
+    struct key_equal
+    {
+        template <class T1, class T2>
+        bool operator()(T1 const & x, T2 const & y) const
+        {
+            return std::get<0>(x) == std::get<0>(y);
+        }
+    };
+}
+
+TEST_CASE("cursors/zip: traversal")
+{
+    std::vector<int> const keys{3, 1, 4, 1, 5};
+    std::list<std::string> const names{"three", "one", "four"};
+
+    auto cur = sayan::zip_cursor(keys, names);
+
+    static_assert(sayan::is_cursor<decltype(cur)>::value, "");
+
+    REQUIRE(!!cur);
+    CHECK(std::get<0>(*cur) == 3);
+    CHECK(std::get<1>(*cur) == "three");
+
+    ++ cur;
+    CHECK(*cur == std::make_tuple(1, std::string("one")));
+
+    ++ cur;
+    ++ cur;
+
+    // Исчерпан, так как исчерпана более короткая последовательность
+    CHECK(!cur);
+
+    auto const t = cur.traversed(sayan::front);
+    CHECK(std::get<0>(t.bases()).begin() == keys.begin());
+    CHECK(std::get<0>(t.bases()).end() == keys.begin() + 3);
+}
+
+TEST_CASE("cursors/zip: random access")
+{
+    std::vector<int> const keys{3, 1, 4, 1, 5};
+    std::vector<char> const tags{'a', 'b', 'c', 'd'};
+
+    auto cur = sayan::zip_cursor(keys, tags);
+
+    static_assert(sayan::is_sized_cursor<decltype(cur)>::value, "");
+
+    CHECK(cur.size() == 4);
+    CHECK(std::get<0>(cur[2]) == 4);
+    CHECK(std::get<1>(cur[2]) == 'c');
+
+    cur += 3;
+
+    CHECK(cur.size() == 1);
+    CHECK(std::get<1>(*cur) == 'd');
+
+    cur.exhaust(sayan::front);
+
+    CHECK(!cur);
+    CHECK(std::get<0>(cur.bases()).begin() == keys.begin() + 4);
+}
+
+TEST_CASE("cursors/zip: value_type and assignment")
+{
+    std::vector<int> keys{3, 1};
+    std::vector<std::string> names{"three", "one"};
+
+    auto cur = sayan::zip_cursor(keys, names);
+
+    using Cursor = decltype(cur);
+    static_assert(std::is_same<Cursor::value_type, std::tuple<int, std::string>>::value, "");
+
+    Cursor::value_type const old = *cur;
+
+    *cur = std::make_tuple(2, std::string("two"));
+    CHECK(keys[0] == 2);
+    CHECK(names[0] == "two");
+
+    *cur = old;
+    CHECK(keys[0] == 3);
+    CHECK(names[0] == "three");
+
+    auto next = cur;
+    ++ next;
+
+    // Присваивание прокси-ссылок копирует, а не перемещает
+    *cur = std::move(*next);
+    CHECK(keys == (std::vector<int>{1, 1}));
+    CHECK(names == (std::vector<std::string>{"one", "one"}));
+}
+
+TEST_CASE("cursors/zip: cursor_move")
+{
+    std::vector<int> keys{3, 1};
+    std::vector<std::string> names{"three", "one"};
+
+    auto cur = sayan::zip_cursor(keys, names);
+
+    using Cursor = decltype(cur);
+    static_assert(std::is_same<sayan::cursor_rvalue_reference_t<Cursor>,
+                               sayan::zip_reference<int &&, std::string &&>>::value, "");
+
+    auto next = cur;
+    ++ next;
+
+    *cur = sayan::cursor_move(next);
+    CHECK(keys[0] == 1);
+    CHECK(names[0] == "one");
+    CHECK(names[1].empty());
+
+    Cursor::value_type tmp = sayan::cursor_move(cur);
+    CHECK(tmp == std::make_tuple(1, std::string("one")));
+    CHECK(names[0].empty());
+
+    *next = std::move(tmp);
+    CHECK(names[1] == "one");
+}
+
+TEST_CASE("cursors/zip: copy")
+{
+    std::vector<std::string> const a_src{"a", "b", "c"};
+    std::vector<std::string> const b_src{"x", "y", "z"};
+
+    auto a = a_src;
+    auto b = b_src;
+    std::vector<std::string> c(3);
+    std::vector<std::string> d(3);
+
+    sayan::copy(sayan::zip_cursor(a, b), sayan::zip_cursor(c, d));
+
+    CHECK(a == a_src);
+    CHECK(b == b_src);
+    CHECK(c == a_src);
+    CHECK(d == b_src);
+}
+
+TEST_CASE("cursors/zip: move")
+{
+    std::vector<int> keys{1, 2};
+    std::vector<std::unique_ptr<int>> ptrs;
+    ptrs.emplace_back(new int(10));
+    ptrs.emplace_back(new int(20));
+
+    std::vector<int> keys_out(2);
+    std::vector<std::unique_ptr<int>> ptrs_out(2);
+
+    sayan::move(sayan::zip_cursor(keys, ptrs), sayan::zip_cursor(keys_out, ptrs_out));
+
+    CHECK(keys_out == keys);
+    REQUIRE(ptrs_out[0] != nullptr);
+    REQUIRE(ptrs_out[1] != nullptr);
+    CHECK(*ptrs_out[0] == 10);
+    CHECK(*ptrs_out[1] == 20);
+    CHECK(ptrs[0] == nullptr);
+    CHECK(ptrs[1] == nullptr);
+}
+
+TEST_CASE("cursors/zip: cursor_swap")
+{
+    std::vector<int> keys{3, 1};
+    std::vector<std::string> names{"three", "one"};
+
+    auto c1 = sayan::zip_cursor(keys, names);
+    auto c2 = c1;
+    ++ c2;
+
+    sayan::cursor_swap(c1, c2);
+
+    CHECK(keys == (std::vector<int>{1, 3}));
+    CHECK(names == (std::vector<std::string>{"one", "three"}));
+}
+
+TEST_CASE("cursors/zip: sort columns")
+{
+    std::vector<int> keys{5, 3, 9, 1, 7, 2};
+    std::vector<std::string> names{"five", "three", "nine", "one", "seven", "two"};
+    std::vector<double> weights{0.5, 0.3, 0.9, 0.1, 0.7, 0.2};
+
+    sayan::sort(sayan::zip_cursor(keys, names, weights));
+
+    CHECK(keys == (std::vector<int>{1, 2, 3, 5, 7, 9}));
+    CHECK(names == (std::vector<std::string>{"one", "two", "three", "five", "seven", "nine"}));
+    CHECK(weights == (std::vector<double>{0.1, 0.2, 0.3, 0.5, 0.7, 0.9}));
+}
+
+TEST_CASE("cursors/zip: sort by key")
+{
+    std::vector<int> keys{2, 1, 2, 1};
+    std::vector<int> values{1, 2, 3, 4};
+
+    sayan::sort(sayan::zip_cursor(keys, values), key_less{});
+
+    CHECK(keys == (std::vector<int>{1, 1, 2, 2}));
+
+    for(std::size_t i = 0; i != keys.size(); ++ i)
+    {
+        CHECK(keys[i] == 1 + values[i] % 2);
+    }
+}
+
+TEST_CASE("cursors/zip: stable_partition")
+{
+    std::vector<int> keys{1, 2, 3, 4, 5, 6, 7};
+    std::vector<char> tags{'a', 'b', 'c', 'd', 'e', 'f', 'g'};
+
+    auto const is_even = [](auto const & x) { return std::get<0>(x) % 2 == 0; };
+
+    auto const r = sayan::stable_partition(sayan::zip_cursor(keys, tags), is_even);
+
+    CHECK(keys == (std::vector<int>{2, 4, 6, 1, 3, 5, 7}));
+    CHECK(tags == (std::vector<char>{'b', 'd', 'f', 'a', 'c', 'e', 'g'}));
+    CHECK(std::get<0>(r.bases()).begin() == keys.begin() + 3);
+}
+
+TEST_CASE("cursors/zip: unique")
+{
+    std::vector<int> keys{1, 1, 2, 2, 2, 3, 1};
+    std::vector<std::string> names{"a", "b", "c", "d", "e", "f", "g"};
+
+    auto const r = sayan::unique(sayan::zip_cursor(keys, names), key_equal{});
+
+    auto const n = std::get<0>(r.bases()).begin() - keys.begin();
+
+    REQUIRE(n == 4);
+    keys.resize(n);
+    names.resize(n);
+
+    CHECK(keys == (std::vector<int>{1, 2, 3, 1}));
+    CHECK(names == (std::vector<std::string>{"a", "c", "f", "g"}));
+}
+
+TEST_CASE("cursors/zip: rotate")
+{
+    std::vector<int> keys{1, 2, 3, 4, 5};
+    std::vector<char> tags{'a', 'b', 'c', 'd', 'e'};
+
+    auto cur = sayan::zip_cursor(keys, tags);
+    cur += 2;
+
+    sayan::rotate(cur);
+
+    CHECK(keys == (std::vector<int>{3, 4, 5, 1, 2}));
+    CHECK(tags == (std::vector<char>{'c', 'd', 'e', 'a', 'b'}));
+}
@@ -2,10 +2,20 @@
 
 #include <sayan/cursor/back_inserter.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <forward_list>
 #include <numeric>
 #include <iterator>
-
+#include <limits>
+#include <list>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../../simple_test.hpp"
 #include <catch/catch.hpp>
 
 TEST_CASE("numeric/iota_test")
@@ -48,6 +58,107 @@ TEST_CASE("numeric/iota_test: explicit cursor")
     CHECK(result.end() == xs.end());
 }
 
+TEST_CASE("numeric/iota_test: contiguous")
+{
+    // Пары (тип элемента, тип значения), в том числе индексы типа int и
+    // значения более узкого типа, чем элементы
+    sayan::test::for_each_type<std::pair<std::int8_t, std::int8_t>,
+                               std::pair<std::uint8_t, std::uint8_t>,
+                               std::pair<std::int16_t, std::int16_t>,
+                               std::pair<std::uint16_t, std::uint16_t>,
+                               std::pair<std::int32_t, std::int32_t>,
+                               std::pair<std::uint32_t, std::uint32_t>,
+                               std::pair<std::int64_t, std::int64_t>,
+                               std::pair<std::uint64_t, std::uint64_t>,
+                               std::pair<std::size_t, int>,
+                               std::pair<std::uint16_t, int>,
+                               std::pair<std::uint32_t, std::uint16_t>,
+                               std::pair<std::int64_t, std::int16_t>,
+                               std::pair<double, double>,
+                               std::pair<float, float>>([](auto tag)
+    {
+        using T = typename decltype(tag)::type::first_type;
+        using Value = typename decltype(tag)::type::second_type;
+        using L = std::numeric_limits<Value>;
+
+        // Значения без знака и более узкие, чем int, переполняются без неопределённого поведения
+        auto const wraps = std::is_integral<Value>::value
+                           && (std::is_unsigned<Value>::value || sizeof(Value) < sizeof(int));
+
+        auto const negative = std::is_integral<Value>::value ? static_cast<Value>(-20)
+                                                             : static_cast<Value>(-20.25);
+
+        for(auto const init_value : {negative, wraps ? static_cast<Value>(L::max() - 5) : Value(42)})
+        for(auto n : {0, 1, 2, 7, 15, 16, 17, 33, 100})
+        {
+            CAPTURE(init_value);
+            CAPTURE(n);
+
+            std::vector<T> xs_std(n + 1, T(7));
+            auto xs = xs_std;
+
+            std::iota(xs_std.begin(), xs_std.begin() + n, init_value);
+
+            auto cur = sayan::cursor(xs);
+            cur.drop(sayan::back);
+
+            auto const result = sayan::iota(cur, init_value);
+
+            CHECK(xs == xs_std);
+            CHECK(result.begin() == xs.begin() + n);
+            CHECK(result.end() == xs.begin() + n);
+        }
+    });
+}
+
+TEST_CASE("numeric/iota_test: step")
+{
+    // Тройки (тип элемента, тип значения, тип шага)
+    sayan::test::for_each_type<std::tuple<int, int, int>,
+                               std::tuple<std::uint8_t, std::uint8_t, int>,
+                               std::tuple<std::int16_t, std::int16_t, std::int16_t>,
+                               std::tuple<std::int64_t, std::int64_t, unsigned>,
+                               std::tuple<std::uint32_t, unsigned, unsigned>,
+                               std::tuple<std::ptrdiff_t, std::ptrdiff_t, std::ptrdiff_t>,
+                               std::tuple<std::int64_t, std::int32_t, std::int64_t>,
+                               std::tuple<std::uint64_t, std::uint32_t, unsigned>,
+                               std::tuple<double, double, double>>([](auto tag)
+    {
+        using Types = typename decltype(tag)::type;
+        using T = std::tuple_element_t<0, Types>;
+        using Value = std::tuple_element_t<1, Types>;
+        using Step = std::tuple_element_t<2, Types>;
+
+        for(auto const init_value : {Value(5), static_cast<Value>(std::numeric_limits<Value>::max() / 2)})
+        for(auto const step : {Step(3), Step(0), static_cast<Step>(-7)})
+        for(auto n : {0, 1, 3, 16, 17, 50})
+        {
+            CAPTURE(init_value);
+            CAPTURE(step);
+            CAPTURE(n);
+
+            std::vector<T> expected(n);
+            auto value = init_value;
+            for(auto & x : expected)
+            {
+                x = static_cast<T>(value);
+                value += step;
+            }
+
+            std::vector<T> xs(n, T(0));
+            auto const result = sayan::iota(xs, init_value, step);
+
+            CHECK(xs == expected);
+            CHECK(!result);
+
+            std::forward_list<T> ys(n, T(0));
+            sayan::iota(ys, init_value, step);
+
+            CHECK(std::equal(ys.begin(), ys.end(), expected.begin(), expected.end()));
+        }
+    });
+}
+
 TEST_CASE("numeric/accumulate")
 {
     std::string const src{"0123456789abcdef"};
@@ -89,6 +200,135 @@ TEST_CASE("numeric/innter_product")
     CHECK(r == r_std);
 }
 
+TEST_CASE("numeric/inner_product: contiguous arithmetic, exact")
+{
+    sayan::test::for_each_type<std::int16_t, std::int32_t, std::uint64_t, float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        auto const init_value = T(17);
+
+        for(std::size_t n : {0, 1, 3, 4, 5, 15, 16, 17, 64, 131})
+        {
+            CAPTURE(n);
+
+            std::vector<T> xs(n);
+            std::vector<T> ys(n + 3);
+
+            for(std::size_t i = 0; i != n; ++ i)
+            {
+                xs[i] = static_cast<T>(static_cast<int>(i % 11) - 5);
+                ys[i] = static_cast<T>(static_cast<int>(i * 7 % 13) - 6);
+            }
+
+            auto const expected = std::inner_product(xs.begin(), xs.end(), ys.begin(), init_value);
+
+            CHECK(sayan::inner_product(xs, ys, init_value) == expected);
+            CHECK(sayan::inner_product(ys, xs, init_value) == expected);
+            CHECK(sayan::transform_reduce(xs, ys, init_value) == expected);
+        }
+    });
+}
+
+TEST_CASE("numeric/inner_product: contiguous signed integers, no intermediate overflow")
+{
+    auto const big = std::numeric_limits<int>::max() / 2;
+
+    std::vector<int> xs(64);
+    std::vector<int> ys(64, 1);
+
+    for(std::size_t i = 0; i != xs.size(); ++ i)
+    {
+        xs[i] = (i % 2 == 0) ? big : -big;
+    }
+
+    CHECK(sayan::inner_product(xs, ys, 5) == 5);
+    CHECK(sayan::transform_reduce(xs, ys, 5) == 5);
+}
+
+TEST_CASE("numeric/transform_reduce: custom ops")
+{
+    std::list<int> const xs{1, 2, 3, 4, 5};
+    std::vector<int> const ys{5, 4, 3, 2, 1, 0};
+
+    auto const expected = std::inner_product(xs.begin(), xs.end(), ys.begin(), 7,
+                                             [](int x, int y) { return std::max(x, y); },
+                                             std::multiplies<>{});
+
+    CHECK(sayan::transform_reduce(xs, ys, 7,
+                                  [](int x, int y) { return std::max(x, y); },
+                                  std::multiplies<>{}) == expected);
+}
+
+TEST_CASE("numeric/inner_product: contiguous floating point, strict order")
+{
+    std::vector<double> xs(101);
+    std::vector<double> ys(101);
+
+    for(std::size_t i = 0; i != xs.size(); ++ i)
+    {
+        xs[i] = 1.0 / static_cast<double>(i + 1);
+        ys[i] = (i % 2 == 0) ? 1e8 : -1e-3 * static_cast<double>(i);
+    }
+
+    auto const strict = std::inner_product(xs.begin(), xs.end(), ys.begin(), 0.0);
+
+    CHECK(sayan::inner_product(xs, ys, 0.0) == strict);
+    CHECK(sayan::transform_reduce(xs, ys, 0.0) == Approx(strict));
+}
+
+#if !defined(__FMA__)
+TEST_CASE("numeric/transform_reduce: contiguous floating point, documented order")
+{
+#if defined(__SSE2__)
+    std::size_t const lanes = 4;
+#else
+    std::size_t const lanes = 1;
+#endif
+    std::size_t const k = 4 * lanes;
+
+    for(std::size_t n : {2, 16, 37, 200})
+    {
+        CAPTURE(n);
+
+        std::vector<float> xs(n);
+        std::vector<float> ys(n);
+
+        for(std::size_t i = 0; i != n; ++ i)
+        {
+            xs[i] = 1.0f / static_cast<float>(i + 3);
+            ys[i] = (i % 5 == 0) ? 3e5f : 0.7f;
+        }
+
+        auto expected = 1.5f;
+        auto const n_full = n / k * k;
+
+        if(n_full != 0)
+        {
+            std::vector<float> partial(k, 0.0f);
+
+            for(std::size_t i = 0; i != n_full; ++ i)
+            {
+                partial[i % k] += xs[i] * ys[i];
+            }
+
+            for(std::size_t j = 0; j != lanes; ++ j)
+            {
+                expected += (partial[j] + partial[lanes + j])
+                          + (partial[2 * lanes + j] + partial[3 * lanes + j]);
+            }
+        }
+
+        for(auto i = n_full; i != n; ++ i)
+        {
+            expected += xs[i] * ys[i];
+        }
+
+        CHECK(sayan::transform_reduce(xs, ys, 1.5f) == expected);
+    }
+}
+#endif
+
 TEST_CASE("numeric/innter_product: custom ops")
 {
     std::string const src_1{"abcdef"};
@@ -106,6 +346,154 @@ TEST_CASE("numeric/innter_product: custom ops")
     CHECK(r == r_std);
 }
 
+TEST_CASE("numeric/reduce: integers, exact")
+{
+    sayan::test::for_each_type<std::int8_t, std::uint8_t, std::int16_t, std::uint16_t,
+                               std::int32_t, std::uint32_t, std::int64_t, std::uint64_t>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        for(std::size_t n : {0, 1, 3, 4, 7, 8, 15, 16, 17, 63, 64, 100, 1001})
+        {
+            CAPTURE(n);
+
+            std::vector<T> xs(n);
+            for(std::size_t i = 0; i != n; ++ i)
+            {
+                xs[i] = static_cast<T>(static_cast<long>(i * 37 % 101) - 50);
+            }
+
+            std::vector<T> const & cxs = xs;
+
+            auto const sum = std::accumulate(xs.begin(), xs.end(), T(3));
+
+            CHECK(sayan::reduce(xs, T(3)) == sum);
+            CHECK(sayan::reduce(cxs, T(3)) == sum);
+
+            CHECK(sayan::reduce(xs, T(0x55), std::bit_xor<>{})
+                  == std::accumulate(xs.begin(), xs.end(), T(0x55), std::bit_xor<>{}));
+            CHECK(sayan::reduce(xs, T(0), std::bit_or<>{})
+                  == std::accumulate(xs.begin(), xs.end(), T(0), std::bit_or<>{}));
+            CHECK(sayan::reduce(xs, T(-1), std::bit_and<>{})
+                  == std::accumulate(xs.begin(), xs.end(), T(-1), std::bit_and<>{}));
+
+            /* Последовательное произведение не переполняется, только если оно
+            вычисляется в беззнаковом типе или сомножители однобайтовые
+            */
+            if(std::is_unsigned<decltype(T() * T())>::value || sizeof(T) == 1)
+            {
+                CHECK(sayan::reduce(xs, T(1), std::multiplies<>{})
+                      == std::accumulate(xs.begin(), xs.end(), T(1), std::multiplies<>{}));
+            }
+        }
+    });
+}
+
+TEST_CASE("numeric/reduce: signed integers, no intermediate overflow")
+{
+    auto const big = std::numeric_limits<std::int32_t>::max() / 2;
+
+    std::vector<std::int32_t> sums(67);
+
+    for(std::size_t i = 0; i != sums.size(); ++ i)
+    {
+        sums[i] = (i % 2 == 0) ? big : -big;
+    }
+
+    CHECK(sayan::reduce(sums, std::int32_t{-3}) == big - 3);
+
+    std::vector<std::int32_t> products(19, 1 << 20);
+    products[0] = 0;
+
+    CHECK(sayan::reduce(products, std::int32_t{1}, std::multiplies<>{}) == 0);
+
+    std::vector<std::int64_t> wide(19, std::int64_t{1} << 40);
+    wide[0] = 0;
+
+    CHECK(sayan::reduce(wide, std::int64_t{1}, std::multiplies<>{}) == 0);
+}
+
+TEST_CASE("numeric/reduce: floating point, integral values")
+{
+    sayan::test::for_each_type<float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        for(std::size_t n : {0, 1, 3, 4, 7, 8, 15, 16, 17, 63, 64, 100, 1001})
+        {
+            CAPTURE(n);
+
+            std::vector<T> xs(n);
+            for(std::size_t i = 0; i != n; ++ i)
+            {
+                xs[i] = static_cast<T>(static_cast<long>(i * 37 % 101) - 50);
+            }
+
+            CHECK(sayan::reduce(xs, T(0.5)) == std::accumulate(xs.begin(), xs.end(), T(0.5)));
+        }
+    });
+}
+
+TEST_CASE("numeric/reduce: floating point, documented order")
+{
+#if defined(__SSE2__)
+    std::size_t const lanes = 4;
+#else
+    std::size_t const lanes = 1;
+#endif
+    std::size_t const k = 4 * lanes;
+
+    for(std::size_t n : {3, 16, 50, 333})
+    {
+        CAPTURE(n);
+
+        std::vector<float> xs(n);
+        for(std::size_t i = 0; i != n; ++ i)
+        {
+            xs[i] = 1.0f / static_cast<float>(i + 1) + (i % 7 == 0 ? 1e6f : 0.0f);
+        }
+
+        auto expected = 0.25f;
+        auto const n_full = (n < k) ? 0 : n / k * k;
+
+        if(n_full != 0)
+        {
+            std::vector<float> partial(xs.begin(), xs.begin() + k);
+
+            for(std::size_t i = k; i != n_full; ++ i)
+            {
+                partial[i % k] += xs[i];
+            }
+
+            // Блоки объединяются как (b0 + b1) + (b2 + b3), затем элементы блока по порядку
+            for(std::size_t j = 0; j != lanes; ++ j)
+            {
+                expected += (partial[j] + partial[lanes + j])
+                          + (partial[2 * lanes + j] + partial[3 * lanes + j]);
+            }
+        }
+
+        for(auto i = n_full; i != n; ++ i)
+        {
+            expected += xs[i];
+        }
+
+        CHECK(sayan::reduce(xs, 0.25f) == expected);
+    }
+}
+
+TEST_CASE("numeric/reduce: sequential fallback")
+{
+    std::forward_list<std::string> const xs{"a", "bc", "", "def"};
+
+    CHECK(sayan::reduce(xs, std::string("!")) == "!abcdef");
+
+    std::vector<int> const ys{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    // Тип начального значения отличается от типа элементов
+    CHECK(sayan::reduce(ys, 0.5) == 45.5);
+}
+
 TEST_CASE("numeric/inner_product: curstom ops, first is shorter")
 {
     using Container = std::vector<int>;
@@ -220,6 +608,142 @@ TEST_CASE("numeric/partial_sum: custom operation, to shorter")
     CHECK(std::get<1>(result).end() == xs.end());
 }
 
+namespace
+{
+    template <class T>
+    std::vector<T> partial_sum_test_input(std::size_t n)
+    {
+        std::vector<T> xs(n);
+
+        for(std::size_t i = 0; i != n; ++ i)
+        {
+            xs[i] = static_cast<T>(static_cast<int>(i * 29 % 17) - 8);
+        }
+
+        return xs;
+    }
+}
+
+TEST_CASE("numeric/partial_sum: contiguous arithmetic")
+{
+    sayan::test::for_each_type<std::int8_t, std::uint16_t, std::int32_t, std::int64_t,
+                               float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        for(std::size_t n : {0, 1, 2, 15, 16, 17, 33, 200, 1000})
+        {
+            CAPTURE(n);
+
+            auto const xs = partial_sum_test_input<T>(n);
+
+            std::vector<T> expected(n);
+            std::partial_sum(xs.begin(), xs.end(), expected.begin());
+
+            std::vector<T> out(n + 2, T(42));
+            auto const r = sayan::partial_sum(xs, out);
+
+            CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+            CHECK(out[n] == T(42));
+            CHECK(!r.first);
+            CHECK(r.second.size() == 2);
+
+            auto in_place = xs;
+            sayan::partial_sum(in_place, in_place);
+
+            CHECK(in_place == expected);
+
+            std::vector<T> scanned(n);
+            sayan::inclusive_scan(xs, scanned);
+
+            CHECK(scanned == expected);
+
+            if(n > 3)
+            {
+                std::vector<T> shorter(n - 3);
+                auto const r_short = sayan::partial_sum(xs, shorter);
+
+                CHECK(std::equal(shorter.begin(), shorter.end(), expected.begin()));
+                CHECK(r_short.first.size() == 3);
+                CHECK(!r_short.second);
+            }
+        }
+    });
+}
+
+TEST_CASE("numeric/partial_sum: contiguous, overlapping output")
+{
+    auto const src = partial_sum_test_input<unsigned>(50);
+
+    for(std::ptrdiff_t shift : {-5, -1, 1, 5})
+    {
+        CAPTURE(shift);
+
+        std::vector<unsigned> buffer(60, 0);
+        std::copy(src.begin(), src.end(), buffer.begin() + 5);
+
+        auto expected = buffer;
+        {
+            auto const in = expected.data() + 5;
+            auto const out = in + shift;
+
+            auto value = in[0];
+            out[0] = value;
+
+            for(std::size_t i = 1; i != src.size(); ++ i)
+            {
+                value = value + in[i];
+                out[i] = value;
+            }
+        }
+
+        auto const in = sayan::pointer_cursor_type<unsigned>(buffer.data() + 5, buffer.data() + 55);
+        auto const out = sayan::pointer_cursor_type<unsigned>(buffer.data() + 5 + shift,
+                                                              buffer.data() + 55 + shift);
+
+        sayan::partial_sum(in, out);
+
+        CHECK(buffer == expected);
+    }
+}
+
+TEST_CASE("numeric/partial_sum: contiguous floating point, negative zero")
+{
+    std::vector<double> const xs(20, -0.0);
+    std::vector<double> out(20, 1.0);
+
+    sayan::inclusive_scan(xs, out);
+
+    CHECK(std::all_of(out.begin(), out.end(), [](double x) { return x == 0.0 && std::signbit(x); }));
+}
+
+TEST_CASE("numeric/partial_sum: contiguous floating point, strict order")
+{
+    std::vector<double> xs(101);
+
+    for(std::size_t i = 0; i != xs.size(); ++ i)
+    {
+        xs[i] = (i % 3 == 0) ? 1e16 : 1.0 / static_cast<double>(i + 1);
+    }
+
+    std::vector<double> expected(xs.size());
+    std::partial_sum(xs.begin(), xs.end(), expected.begin());
+
+    std::vector<double> out(xs.size());
+    sayan::partial_sum(xs, out);
+
+    CHECK(out == expected);
+
+    std::vector<double> scanned(xs.size());
+    sayan::inclusive_scan(xs, scanned);
+
+    for(std::size_t i = 0; i != xs.size(); ++ i)
+    {
+        CAPTURE(i);
+        CHECK(scanned[i] == Approx(expected[i]));
+    }
+}
+
 TEST_CASE("numeric/adjacent_difference")
 {
     std::string const src{"0123456789abcdef"};
@@ -294,3 +818,110 @@ TEST_CASE("numeric/adjacent_difference: custom operation, to shorter")
     CHECK(std::get<1>(result).begin() == xs.end());
     CHECK(std::get<1>(result).end() == xs.end());
 }
+
+TEST_CASE("numeric/adjacent_difference: contiguous arithmetic")
+{
+    sayan::test::for_each_type<std::int8_t, std::uint16_t, std::int32_t, std::int64_t,
+                               float, double>([](auto tag)
+    {
+        using T = typename decltype(tag)::type;
+
+        for(std::size_t n : {0, 1, 2, 15, 16, 17, 33, 200, 1000})
+        {
+            CAPTURE(n);
+
+            auto const xs = partial_sum_test_input<T>(n);
+
+            std::vector<T> expected(n);
+            std::adjacent_difference(xs.begin(), xs.end(), expected.begin());
+
+            std::vector<T> out(n + 2, T(42));
+            auto const r = sayan::adjacent_difference(xs, out);
+
+            CHECK(std::equal(expected.begin(), expected.end(), out.begin()));
+            CHECK(out[n] == T(42));
+            CHECK(!r.first);
+            CHECK(r.second.size() == 2);
+
+            auto in_place = xs;
+            sayan::adjacent_difference(in_place, in_place);
+
+            CHECK(in_place == expected);
+
+            sayan::partial_sum(in_place, in_place);
+
+            CHECK(in_place == xs);
+
+            if(n > 3)
+            {
+                std::vector<T> shorter(n - 3);
+                auto const r_short = sayan::adjacent_difference(xs, shorter);
+
+                CHECK(std::equal(shorter.begin(), shorter.end(), expected.begin()));
+                CHECK(r_short.first.size() == 3);
+                CHECK(!r_short.second);
+            }
+        }
+    });
+}
+
+TEST_CASE("numeric/adjacent_difference: contiguous, overlapping output")
+{
+    auto const src = partial_sum_test_input<int>(50);
+
+    for(std::ptrdiff_t shift : {-5, -1, 1, 5})
+    {
+        CAPTURE(shift);
+
+        std::vector<int> buffer(60, 0);
+        std::copy(src.begin(), src.end(), buffer.begin() + 5);
+
+        auto expected = buffer;
+        {
+            auto const in = expected.data() + 5;
+            auto const out = in + shift;
+
+            auto prev = in[0];
+            out[0] = prev;
+
+            for(std::size_t i = 1; i != src.size(); ++ i)
+            {
+                auto const cur = in[i];
+                out[i] = cur - prev;
+                prev = cur;
+            }
+        }
+
+        auto const in = sayan::pointer_cursor_type<int>(buffer.data() + 5, buffer.data() + 55);
+        auto const out = sayan::pointer_cursor_type<int>(buffer.data() + 5 + shift,
+                                                         buffer.data() + 55 + shift);
+
+        sayan::adjacent_difference(in, out);
+
+        CHECK(buffer == expected);
+    }
+}
+
+TEST_CASE("numeric/adjacent_difference: delta encoding round trip")
+{
+    std::vector<std::int64_t> timestamps(300);
+
+    std::int64_t time = 1700000000000;
+    for(std::size_t i = 0; i != timestamps.size(); ++ i)
+    {
+        time += static_cast<std::int64_t>(i * 37 % 11);
+        timestamps[i] = time;
+    }
+
+    std::vector<std::int64_t> deltas(timestamps.size());
+    sayan::adjacent_difference(timestamps, deltas);
+
+    CHECK(deltas.front() == timestamps.front());
+    CHECK(std::all_of(deltas.begin() + 1, deltas.end(),
+                      [](std::int64_t x) { return 0 <= x && x < 11; }));
+
+    std::vector<std::int64_t> decoded(deltas.size());
+    sayan::partial_sum(deltas, decoded);
+
+    CHECK(decoded == timestamps);
+}